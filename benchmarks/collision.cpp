@@ -0,0 +1,196 @@
+#include <benchmark/benchmark.h>
+#include <paulista/paulista.hpp>
+
+#include <cmath>
+#include <random>
+#include <span>
+#include <vector>
+
+using Millimeter    = paulista::dimension::Millimeter;
+using Micrometer    = paulista::dimension::Micrometer;
+
+// Points spread over a ball, so every one of them is a candidate support
+// point and hulls are not trivially small.
+template <typename T>
+paulista::collision::Shape<T>
+ball(std::size_t n, std::int32_t radius, std::int32_t offset, unsigned seed) {
+    std::mt19937 engine(seed);
+    std::normal_distribution<double> normal;
+
+    paulista::collision::Shape<T> ps;
+    ps.reserve(n);
+    for (std::size_t i = 0; i < n; i++) {
+        double x = normal(engine);
+        double y = normal(engine);
+        double z = normal(engine);
+        double scale = radius / std::max(1e-9, std::sqrt((x * x) + (y * y) + (z * z)));
+        ps.emplace_back(
+                  static_cast<std::int32_t>(x * scale) + offset
+                , static_cast<std::int32_t>(y * scale)
+                , static_cast<std::int32_t>(z * scale)
+                );
+    }
+    return ps;
+}
+
+template <typename T>
+std::vector<paulista::tridimensional::Vector<T>>
+directions(std::size_t n) {
+    paulista::collision::Shape<T> vs = ball<T>(n, 1 << 20, 0, 7);
+    return {vs.begin(), vs.end()};
+}
+
+template <typename T>
+void
+support_shape(benchmark::State& state) {
+    paulista::collision::Shape<T> ps = ball<T>(state.range(0), 1 << 20, 0, 1);
+    std::vector<paulista::tridimensional::Vector<T>> vs = directions<T>(64);
+    for (auto _ : state) {
+        for (const paulista::tridimensional::Vector<T>& v : vs) { benchmark::DoNotOptimize(paulista::collision::support(ps, v)); }
+    }
+    state.SetItemsProcessed(state.iterations() * vs.size() * ps.size());
+}
+
+template <typename T>
+void
+support_cloud(benchmark::State& state) {
+    paulista::tridimensional::PointCloud<T> ps(ball<T>(state.range(0), 1 << 20, 0, 1));
+    std::vector<paulista::tridimensional::Vector<T>> vs = directions<T>(64);
+    for (auto _ : state) {
+        for (const paulista::tridimensional::Vector<T>& v : vs) { benchmark::DoNotOptimize(paulista::collision::support(ps, v)); }
+    }
+    state.SetItemsProcessed(state.iterations() * vs.size() * ps.size());
+}
+
+// The 14 directions of a k-DOP in one pass over the points, against
+// support_shape and support_cloud asking for them one at a time.
+template <typename T>
+void
+support_many_shape(benchmark::State& state) {
+    paulista::collision::Shape<T> ps = ball<T>(state.range(0), 1 << 20, 0, 1);
+    std::vector<paulista::tridimensional::Vector<T>> vs = directions<T>(14);
+    std::vector<paulista::tridimensional::Point<T>> out(vs.size());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(paulista::collision::support_many(
+                  ps
+                , std::span<const paulista::tridimensional::Vector<T>>(vs)
+                , std::span<paulista::tridimensional::Point<T>>(out)
+                ));
+    }
+    state.SetItemsProcessed(state.iterations() * vs.size() * ps.size());
+}
+
+template <typename T>
+void
+support_many_cloud(benchmark::State& state) {
+    paulista::tridimensional::PointCloud<T> ps(ball<T>(state.range(0), 1 << 20, 0, 1));
+    std::vector<paulista::tridimensional::Vector<T>> vs = directions<T>(14);
+    std::vector<paulista::tridimensional::Point<T>> out(vs.size());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(paulista::collision::support_many(
+                  ps
+                , std::span<const paulista::tridimensional::Vector<T>>(vs)
+                , std::span<paulista::tridimensional::Point<T>>(out)
+                ));
+    }
+    state.SetItemsProcessed(state.iterations() * vs.size() * ps.size());
+}
+
+template <typename T>
+void
+support_polytope(benchmark::State& state) {
+    paulista::collision::Hull<T> h = paulista::collision::hull(ball<T>(state.range(0), 1 << 20, 0, 1));
+    paulista::collision::Polytope<T> ps(h.vertices, h.faces);
+    std::vector<paulista::tridimensional::Vector<T>> vs = directions<T>(64);
+    for (auto _ : state) {
+        for (const paulista::tridimensional::Vector<T>& v : vs) { benchmark::DoNotOptimize(paulista::collision::support(ps, v)); }
+    }
+    state.SetItemsProcessed(state.iterations() * vs.size());
+}
+
+// Pairs of balls of the given size, overlapping when state.range(1) is
+// set and apart otherwise.
+template <typename T>
+void
+detect(benchmark::State& state) {
+    std::int32_t radius = 1 << 20;
+    std::int32_t offset = state.range(1) ? radius : 3 * radius;
+
+    paulista::collision::Shape<T> xs = ball<T>(state.range(0), radius, 0, 1);
+    paulista::collision::Shape<T> ys = ball<T>(state.range(0), radius, offset, 2);
+    for (auto _ : state) { benchmark::DoNotOptimize(paulista::collision::detect(xs, ys)); }
+    state.SetItemsProcessed(state.iterations());
+}
+
+template <typename T>
+void
+detect_cloud(benchmark::State& state) {
+    std::int32_t radius = 1 << 20;
+    std::int32_t offset = state.range(1) ? radius : 3 * radius;
+
+    paulista::tridimensional::PointCloud<T> xs(ball<T>(state.range(0), radius, 0, 1));
+    paulista::tridimensional::PointCloud<T> ys(ball<T>(state.range(0), radius, offset, 2));
+    for (auto _ : state) { benchmark::DoNotOptimize(paulista::collision::detect(xs, ys)); }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Balls a hair apart asked about every frame, which takes GJK several
+// iterations from scratch, through a pair cache when state.range(1) is
+// set and without one otherwise.
+template <typename T>
+void
+detect_cached(benchmark::State& state) {
+    std::int32_t radius = 1 << 20;
+
+    paulista::collision::Shape<T> xs = ball<T>(state.range(0), radius, 0, 1);
+    paulista::collision::Shape<T> ys = ball<T>(state.range(0), radius, 2 * radius + (radius / 64), 2);
+    paulista::collision::Cache<T> cache;
+    for (auto _ : state) {
+        if (state.range(1)) {
+            benchmark::DoNotOptimize(paulista::collision::detect(xs, ys, cache, 0, 1));
+            cache.tick();
+        } else {
+            benchmark::DoNotOptimize(paulista::collision::detect(xs, ys));
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// A moving body seen through a new transformed view every query, instead
+// of a shape rebuilt with its points moved.
+template <typename T>
+void
+detect_transformed(benchmark::State& state) {
+    std::int32_t radius = 1 << 20;
+    std::int32_t offset = state.range(1) ? radius : 3 * radius;
+
+    paulista::collision::Shape<T> xs = ball<T>(state.range(0), radius, 0, 1);
+    paulista::collision::Shape<T> ys = ball<T>(state.range(0), radius, 0, 2);
+    paulista::tridimensional::Rotation r(0.9, 0.1, 0.3, 0.2);
+    for (auto _ : state) {
+        paulista::collision::Transformed<paulista::collision::Shape<T>> ts(ys, r, paulista::tridimensional::Vector<T>(offset, 0, 0));
+        benchmark::DoNotOptimize(paulista::collision::detect(xs, ts));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_TEMPLATE(support_shape,       Millimeter)->RangeMultiplier(8)->Range(1 << 3, 1 << 18);
+BENCHMARK_TEMPLATE(support_shape,       Micrometer)->RangeMultiplier(8)->Range(1 << 3, 1 << 18);
+BENCHMARK_TEMPLATE(support_cloud,       Millimeter)->RangeMultiplier(8)->Range(1 << 3, 1 << 18);
+BENCHMARK_TEMPLATE(support_cloud,       Micrometer)->RangeMultiplier(8)->Range(1 << 3, 1 << 18);
+BENCHMARK_TEMPLATE(support_many_shape,  Millimeter)->RangeMultiplier(8)->Range(1 << 3, 1 << 18);
+BENCHMARK_TEMPLATE(support_many_shape,  Micrometer)->RangeMultiplier(8)->Range(1 << 3, 1 << 18);
+BENCHMARK_TEMPLATE(support_many_cloud,  Millimeter)->RangeMultiplier(8)->Range(1 << 3, 1 << 18);
+BENCHMARK_TEMPLATE(support_many_cloud,  Micrometer)->RangeMultiplier(8)->Range(1 << 3, 1 << 18);
+BENCHMARK_TEMPLATE(support_polytope,    Millimeter)->RangeMultiplier(8)->Range(1 << 3, 1 << 15);
+BENCHMARK_TEMPLATE(support_polytope,    Micrometer)->RangeMultiplier(8)->Range(1 << 3, 1 << 15);
+BENCHMARK_TEMPLATE(detect,              Millimeter)->ArgsProduct({benchmark::CreateRange(1 << 3, 1 << 15, 8), {0, 1}});
+BENCHMARK_TEMPLATE(detect,              Micrometer)->ArgsProduct({benchmark::CreateRange(1 << 3, 1 << 15, 8), {0, 1}});
+BENCHMARK_TEMPLATE(detect_cloud,        Millimeter)->ArgsProduct({benchmark::CreateRange(1 << 3, 1 << 15, 8), {0, 1}});
+BENCHMARK_TEMPLATE(detect_cloud,        Micrometer)->ArgsProduct({benchmark::CreateRange(1 << 3, 1 << 15, 8), {0, 1}});
+BENCHMARK_TEMPLATE(detect_cached,       Millimeter)->ArgsProduct({benchmark::CreateRange(1 << 3, 1 << 15, 8), {0, 1}});
+BENCHMARK_TEMPLATE(detect_cached,       Micrometer)->ArgsProduct({benchmark::CreateRange(1 << 3, 1 << 15, 8), {0, 1}});
+BENCHMARK_TEMPLATE(detect_transformed,  Millimeter)->ArgsProduct({benchmark::CreateRange(1 << 3, 1 << 15, 8), {0, 1}});
+BENCHMARK_TEMPLATE(detect_transformed,  Micrometer)->ArgsProduct({benchmark::CreateRange(1 << 3, 1 << 15, 8), {0, 1}});
+
+BENCHMARK_MAIN();
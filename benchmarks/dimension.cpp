@@ -0,0 +1,73 @@
+#include <benchmark/benchmark.h>
+#include <paulista/paulista.hpp>
+
+#include <random>
+#include <span>
+#include <vector>
+
+using Meter         = paulista::dimension::Meter;
+using Millimeter    = paulista::dimension::Millimeter;
+using Micrometer    = paulista::dimension::Micrometer;
+
+template <typename T>
+std::vector<paulista::tridimensional::Point<T>>
+points(std::size_t n, std::int32_t range) {
+    std::mt19937 engine(42);
+    std::uniform_int_distribution<std::int32_t> coordinate(-range, range);
+
+    std::vector<paulista::tridimensional::Point<T>> ps;
+    ps.reserve(n);
+    for (std::size_t i = 0; i < n; i++) { ps.emplace_back(coordinate(engine), coordinate(engine), coordinate(engine)); }
+    return ps;
+}
+
+// Converting one length at a time through the unit constructors.
+template <typename From, typename To>
+void
+length(benchmark::State& state) {
+    std::vector<paulista::tridimensional::Point<From>> ps = points<From>(state.range(0), 1 << 20);
+    for (auto _ : state) {
+        for (const paulista::tridimensional::Point<From>& p : ps) { benchmark::DoNotOptimize(To(p.x())); }
+    }
+    state.SetItemsProcessed(state.iterations() * ps.size());
+}
+
+template <typename From, typename To>
+void
+pointwise(benchmark::State& state) {
+    std::vector<paulista::tridimensional::Point<From>> ps = points<From>(state.range(0), 1 << 20);
+    std::vector<paulista::tridimensional::Point<To>> qs(ps.size());
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < ps.size(); i++) { qs[i] = static_cast<paulista::tridimensional::Point<To>>(ps[i]); }
+        benchmark::DoNotOptimize(qs.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * ps.size());
+}
+
+template <typename From, typename To>
+void
+convert(benchmark::State& state) {
+    std::vector<paulista::tridimensional::Point<From>> ps = points<From>(state.range(0), 1 << 20);
+    std::vector<paulista::tridimensional::Point<To>> qs(ps.size());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(paulista::tridimensional::point::convert<To>(
+                  std::span<const paulista::tridimensional::Point<From>>(ps)
+                , std::span(qs)
+                ));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * ps.size());
+}
+
+BENCHMARK_TEMPLATE(length,      Micrometer, Millimeter)->RangeMultiplier(16)->Range(1 << 4, 1 << 20);
+BENCHMARK_TEMPLATE(length,      Millimeter, Micrometer)->RangeMultiplier(16)->Range(1 << 4, 1 << 20);
+BENCHMARK_TEMPLATE(length,      Micrometer, Meter)->RangeMultiplier(16)->Range(1 << 4, 1 << 20);
+BENCHMARK_TEMPLATE(pointwise,   Micrometer, Millimeter)->RangeMultiplier(16)->Range(1 << 4, 1 << 20);
+BENCHMARK_TEMPLATE(pointwise,   Millimeter, Micrometer)->RangeMultiplier(16)->Range(1 << 4, 1 << 20);
+BENCHMARK_TEMPLATE(pointwise,   Micrometer, Meter)->RangeMultiplier(16)->Range(1 << 4, 1 << 20);
+BENCHMARK_TEMPLATE(convert,     Micrometer, Millimeter)->RangeMultiplier(16)->Range(1 << 4, 1 << 20);
+BENCHMARK_TEMPLATE(convert,     Millimeter, Micrometer)->RangeMultiplier(16)->Range(1 << 4, 1 << 20);
+BENCHMARK_TEMPLATE(convert,     Micrometer, Meter)->RangeMultiplier(16)->Range(1 << 4, 1 << 20);
+
+BENCHMARK_MAIN();
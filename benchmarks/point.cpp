@@ -0,0 +1,123 @@
+#include <benchmark/benchmark.h>
+#include <paulista/paulista.hpp>
+
+#include <random>
+#include <vector>
+
+using Millimeter    = paulista::dimension::Millimeter;
+using Micrometer    = paulista::dimension::Micrometer;
+
+template <typename T>
+std::vector<paulista::tridimensional::Point<T>>
+points(std::size_t n, std::int32_t range) {
+    std::mt19937 engine(42);
+    std::uniform_int_distribution<std::int32_t> coordinate(-range, range);
+
+    std::vector<paulista::tridimensional::Point<T>> ps;
+    ps.reserve(n);
+    for (std::size_t i = 0; i < n; i++) { ps.emplace_back(coordinate(engine), coordinate(engine), coordinate(engine)); }
+    return ps;
+}
+
+template <typename T>
+void
+add(benchmark::State& state) {
+    std::vector<paulista::tridimensional::Point<T>> ps = points<T>(state.range(0), 1 << 20);
+    for (auto _ : state) {
+        paulista::tridimensional::Point<T> sum;
+        for (const paulista::tridimensional::Point<T>& p : ps) { sum += p; }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * ps.size());
+}
+
+template <typename T>
+void
+dot(benchmark::State& state) {
+    std::vector<paulista::tridimensional::Point<T>> ps = points<T>(state.range(0), 1 << 10);
+    for (auto _ : state) {
+        for (std::size_t i = 1; i < ps.size(); i++) { benchmark::DoNotOptimize(ps[i - 1].dot(ps[i])); }
+    }
+    state.SetItemsProcessed(state.iterations() * ps.size());
+}
+
+template <typename T>
+void
+cross(benchmark::State& state) {
+    std::vector<paulista::tridimensional::Point<T>> ps = points<T>(state.range(0), 1 << 10);
+    for (auto _ : state) {
+        for (std::size_t i = 1; i < ps.size(); i++) { benchmark::DoNotOptimize(ps[i - 1].cross(ps[i])); }
+    }
+    state.SetItemsProcessed(state.iterations() * ps.size());
+}
+
+template <typename T>
+void
+wide_dot(benchmark::State& state) {
+    std::vector<paulista::tridimensional::Point<T>> ps = points<T>(state.range(0), 1 << 29);
+    for (auto _ : state) {
+        for (std::size_t i = 1; i < ps.size(); i++) {
+            benchmark::DoNotOptimize(paulista::tridimensional::point::dot(ps[i - 1], ps[i]));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * ps.size());
+}
+
+template <typename T>
+void
+wide_cross(benchmark::State& state) {
+    std::vector<paulista::tridimensional::Point<T>> ps = points<T>(state.range(0), 1 << 29);
+    for (auto _ : state) {
+        for (std::size_t i = 1; i < ps.size(); i++) {
+            benchmark::DoNotOptimize(paulista::tridimensional::point::cross(ps[i - 1], ps[i]));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * ps.size());
+}
+
+template <typename T>
+void
+orient3d(benchmark::State& state) {
+    std::vector<paulista::tridimensional::Point<T>> ps = points<T>(state.range(0), 1 << 29);
+    for (auto _ : state) {
+        for (std::size_t i = 3; i < ps.size(); i++) {
+            benchmark::DoNotOptimize(paulista::tridimensional::point::orient3d(ps[i - 3], ps[i - 2], ps[i - 1], ps[i]));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * ps.size());
+}
+
+template <typename T>
+void
+centroid(benchmark::State& state) {
+    std::vector<paulista::tridimensional::Point<T>> ps = points<T>(state.range(0), 1 << 29);
+    for (auto _ : state) { benchmark::DoNotOptimize(paulista::tridimensional::point::centroid(ps)); }
+    state.SetItemsProcessed(state.iterations() * ps.size());
+}
+
+template <typename T>
+void
+moments(benchmark::State& state) {
+    std::vector<paulista::tridimensional::Point<T>> ps = points<T>(state.range(0), 1 << 29);
+    for (auto _ : state) { benchmark::DoNotOptimize(paulista::tridimensional::moments::reduce(ps)); }
+    state.SetItemsProcessed(state.iterations() * ps.size());
+}
+
+BENCHMARK_TEMPLATE(add,         Millimeter)->RangeMultiplier(16)->Range(1 << 4, 1 << 20);
+BENCHMARK_TEMPLATE(add,         Micrometer)->RangeMultiplier(16)->Range(1 << 4, 1 << 20);
+BENCHMARK_TEMPLATE(dot,         Millimeter)->RangeMultiplier(16)->Range(1 << 4, 1 << 20);
+BENCHMARK_TEMPLATE(dot,         Micrometer)->RangeMultiplier(16)->Range(1 << 4, 1 << 20);
+BENCHMARK_TEMPLATE(cross,       Millimeter)->RangeMultiplier(16)->Range(1 << 4, 1 << 20);
+BENCHMARK_TEMPLATE(cross,       Micrometer)->RangeMultiplier(16)->Range(1 << 4, 1 << 20);
+BENCHMARK_TEMPLATE(wide_dot,    Millimeter)->RangeMultiplier(16)->Range(1 << 4, 1 << 20);
+BENCHMARK_TEMPLATE(wide_dot,    Micrometer)->RangeMultiplier(16)->Range(1 << 4, 1 << 20);
+BENCHMARK_TEMPLATE(wide_cross,  Millimeter)->RangeMultiplier(16)->Range(1 << 4, 1 << 20);
+BENCHMARK_TEMPLATE(wide_cross,  Micrometer)->RangeMultiplier(16)->Range(1 << 4, 1 << 20);
+BENCHMARK_TEMPLATE(orient3d,    Millimeter)->RangeMultiplier(16)->Range(1 << 4, 1 << 20);
+BENCHMARK_TEMPLATE(orient3d,    Micrometer)->RangeMultiplier(16)->Range(1 << 4, 1 << 20);
+BENCHMARK_TEMPLATE(centroid,    Millimeter)->RangeMultiplier(16)->Range(1 << 4, 1 << 24);
+BENCHMARK_TEMPLATE(centroid,    Micrometer)->RangeMultiplier(16)->Range(1 << 4, 1 << 24);
+BENCHMARK_TEMPLATE(moments,     Millimeter)->RangeMultiplier(16)->Range(1 << 4, 1 << 24)->UseRealTime();
+BENCHMARK_TEMPLATE(moments,     Micrometer)->RangeMultiplier(16)->Range(1 << 4, 1 << 24)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,107 @@
+#ifndef PAULISTA_BOX_HPP__
+#define PAULISTA_BOX_HPP__
+
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+#include <ostream>
+#include <vector>
+
+#include "paulista-point.hpp"
+
+namespace paulista {
+namespace tridimensional {
+    // Axis aligned box over closed intervals, so boxes sharing a face
+    // overlap.
+    template <typename T>
+    class Box {
+        static_assert(dimension::is_dimension<T>::value);
+        public:
+            Box() : lower_(), upper_() {}
+            Box(const Point<T>& p) : lower_(p), upper_(p) {}
+            Box(const Point<T>& lower, const Point<T>& upper) : lower_(lower), upper_(upper) {}
+
+            const Point<T>& lower() const { return lower_; }
+            const Point<T>& upper() const { return upper_; }
+
+            friend bool
+            operator==(const Box<T>& lhs, const Box<T>& rhs) {
+                return (lhs.lower_ == rhs.lower_) and (lhs.upper_ == rhs.upper_);
+            }
+
+            friend bool
+            operator!=(const Box<T>& lhs, const Box<T>& rhs) {
+                return not (lhs == rhs);
+            }
+
+            friend std::ostream&
+            operator<<(std::ostream& os, const Box<T>& b) {
+                return os << "[" << b.lower_ << "," << b.upper_ << "]";
+            }
+
+            Box<T>&
+            operator|=(const Box<T>& other) {
+                lower_ = Point<T>(
+                          std::min(lower_.x(), other.lower_.x())
+                        , std::min(lower_.y(), other.lower_.y())
+                        , std::min(lower_.z(), other.lower_.z())
+                        );
+                upper_ = Point<T>(
+                          std::max(upper_.x(), other.upper_.x())
+                        , std::max(upper_.y(), other.upper_.y())
+                        , std::max(upper_.z(), other.upper_.z())
+                        );
+                return *this;
+            }
+
+            friend Box<T>
+            operator|(Box<T> lhs, const Box<T>& rhs) {
+                lhs |= rhs; return lhs;
+            }
+
+            bool
+            overlaps(const Box<T>& other) const {
+                return  (lower_.x() <= other.upper_.x()) and (other.lower_.x() <= upper_.x())
+                    and (lower_.y() <= other.upper_.y()) and (other.lower_.y() <= upper_.y())
+                    and (lower_.z() <= other.upper_.z()) and (other.lower_.z() <= upper_.z())
+                    ;
+            }
+
+            bool
+            contains(const Point<T>& p) const {
+                return  (lower_.x() <= p.x()) and (p.x() <= upper_.x())
+                    and (lower_.y() <= p.y()) and (p.y() <= upper_.y())
+                    and (lower_.z() <= p.z()) and (p.z() <= upper_.z())
+                    ;
+            }
+
+            double
+            area() const {
+                double dx = static_cast<double>(static_cast<std::int32_t>(upper_.x())) - static_cast<std::int32_t>(lower_.x());
+                double dy = static_cast<double>(static_cast<std::int32_t>(upper_.y())) - static_cast<std::int32_t>(lower_.y());
+                double dz = static_cast<double>(static_cast<std::int32_t>(upper_.z())) - static_cast<std::int32_t>(lower_.z());
+                return 2.0 * ((dx * dy) + (dy * dz) + (dz * dx));
+            }
+        private:
+            Point<T> lower_;
+            Point<T> upper_;
+    };
+namespace box {
+    template <typename T>
+    inline std::optional<Box<T>>
+    bounds(const std::vector<Point<T>>& ps) {
+        static_assert(dimension::is_dimension<T>::value);
+
+        if (ps.empty()) {
+            return std::nullopt;
+        } else {
+            Box<T> b(ps.front());
+            for (const Point<T>& p : ps) { b |= Box<T>(p); }
+            return b;
+        }
+    }
+} // namespace box
+} // namespace tridimensional
+} // namespace paulista
+
+#endif // PAULISTA_BOX_HPP__
@@ -0,0 +1,301 @@
+#ifndef PAULISTA_BVH_HPP__
+#define PAULISTA_BVH_HPP__
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory_resource>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "paulista-box.hpp"
+#include "paulista-point.hpp"
+
+namespace paulista {
+namespace collision {
+    using Pair = std::pair<std::size_t, std::size_t>;
+
+    // Bounding volume hierarchy over the boxes of many shapes, built with a
+    // binned surface area heuristic. Nodes are kept in a flat array where
+    // sibling nodes are adjacent and always stored after their parent, so a
+    // refit is a single reverse sweep.
+    template <typename T>
+    class Bvh {
+        static_assert(dimension::is_dimension<T>::value);
+        public:
+            Bvh() = default;
+
+            explicit Bvh(const std::vector<tridimensional::Box<T>>& boxes)
+                : boxes_(boxes)
+                , indices_(boxes.size())
+            {
+                if (boxes_.empty()) { return; }
+
+                for (std::size_t i = 0; i < indices_.size(); i++) { indices_[i] = i; }
+
+                nodes_.reserve(2 * ((boxes_.size() / leaf) + 1));
+                nodes_.push_back(Node{});
+
+                std::vector<std::array<std::size_t, 3>> pending = {{0, 0, boxes_.size()}};
+                while (not pending.empty()) {
+                    auto [node, begin, end] = pending.back();
+                    pending.pop_back();
+
+                    std::optional<std::size_t> middle = split(begin, end);
+                    if (not middle) {
+                        nodes_[node].first = static_cast<std::uint32_t>(begin);
+                        nodes_[node].count = static_cast<std::uint32_t>(end - begin);
+                    } else {
+                        std::size_t left = nodes_.size();
+                        nodes_[node].first = static_cast<std::uint32_t>(left);
+                        nodes_[node].count = 0;
+                        nodes_.push_back(Node{});
+                        nodes_.push_back(Node{});
+                        pending.push_back({left + 1, *middle, end});
+                        pending.push_back({left, begin, *middle});
+                    }
+                }
+                refit();
+            }
+
+            bool            empty() const   { return boxes_.empty(); }
+            std::size_t     size() const    { return boxes_.size(); }
+            std::size_t     nodes() const   { return nodes_.size(); }
+
+            // Box around every shape, or nothing for an empty tree.
+            std::optional<tridimensional::Box<T>>
+            bounds() const {
+                if (nodes_.empty()) {
+                    return std::nullopt;
+                } else {
+                    return nodes_.front().box;
+                }
+            }
+
+            // Replaces the box of every shape, keeping the tree topology.
+            // Returns false, changing nothing, unless boxes holds one box
+            // per shape the tree was built over.
+            bool
+            refit(const std::vector<tridimensional::Box<T>>& boxes) {
+                if (boxes.size() != boxes_.size()) { return false; }
+
+                boxes_ = boxes;
+                refit();
+                return true;
+            }
+
+            template <typename F>
+            void
+            query(const tridimensional::Box<T>& b, F&& f) const {
+                if (nodes_.empty()) { return; }
+
+                // The traversal stack grows with the depth of the tree,
+                // which fits on the stack for any tree but a degenerate one.
+                std::array<std::byte, 1024> buffer;
+                std::pmr::monotonic_buffer_resource scratch(buffer.data(), buffer.size());
+                std::pmr::vector<std::size_t> stack(&scratch);
+                stack.reserve(buffer.size() / sizeof(std::size_t));
+                stack.push_back(0);
+                while (not stack.empty()) {
+                    const Node& n = nodes_[stack.back()];
+                    stack.pop_back();
+
+                    if (not n.box.overlaps(b)) { continue; }
+                    if (n.count > 0) {
+                        for (std::size_t i = n.first; i < n.first + n.count; i++) {
+                            if (boxes_[indices_[i]].overlaps(b)) { f(indices_[i]); }
+                        }
+                    } else {
+                        stack.push_back(n.first + 1);
+                        stack.push_back(n.first);
+                    }
+                }
+            }
+
+            // Every pair of shapes whose boxes overlap, as (lower, higher)
+            // indices, replacing the contents of ps.
+            void
+            pairs(std::vector<Pair>& ps) const {
+                ps.clear();
+                if (nodes_.empty()) { return; }
+
+                std::array<std::byte, 2048> buffer;
+                std::pmr::monotonic_buffer_resource scratch(buffer.data(), buffer.size());
+                std::pmr::vector<std::pair<std::size_t, std::size_t>> stack(&scratch);
+                stack.reserve(buffer.size() / sizeof(std::pair<std::size_t, std::size_t>));
+                stack.push_back({0, 0});
+                while (not stack.empty()) {
+                    auto [a, b] = stack.back();
+                    stack.pop_back();
+
+                    const Node& u = nodes_[a];
+                    const Node& v = nodes_[b];
+                    if (a == b) {
+                        if (u.count > 0) {
+                            for (std::size_t i = u.first; i < u.first + u.count; i++) {
+                                for (std::size_t j = i + 1; j < u.first + u.count; j++) {
+                                    emit(indices_[i], indices_[j], ps);
+                                }
+                            }
+                        } else {
+                            stack.push_back({u.first, u.first + 1});
+                            stack.push_back({u.first + 1, u.first + 1});
+                            stack.push_back({u.first, u.first});
+                        }
+                    } else if (u.box.overlaps(v.box)) {
+                        if (u.count > 0 and v.count > 0) {
+                            for (std::size_t i = u.first; i < u.first + u.count; i++) {
+                                for (std::size_t j = v.first; j < v.first + v.count; j++) {
+                                    emit(indices_[i], indices_[j], ps);
+                                }
+                            }
+                        } else if (v.count > 0 or (u.count == 0 and u.box.area() > v.box.area())) {
+                            stack.push_back({u.first + 1, b});
+                            stack.push_back({u.first, b});
+                        } else {
+                            stack.push_back({a, v.first + 1});
+                            stack.push_back({a, v.first});
+                        }
+                    }
+                }
+            }
+
+            std::vector<Pair>
+            pairs() const {
+                std::vector<Pair> ps;
+                pairs(ps);
+                return ps;
+            }
+        private:
+            static constexpr std::size_t leaf = 4;
+            static constexpr std::size_t bins = 16;
+
+            struct Node {
+                tridimensional::Box<T>  box;
+                std::uint32_t           first;
+                std::uint32_t           count;
+            };
+
+            void
+            emit(std::size_t i, std::size_t j, std::vector<Pair>& ps) const {
+                if (boxes_[i].overlaps(boxes_[j])) {
+                    ps.push_back(i < j ? Pair{i, j} : Pair{j, i});
+                }
+            }
+
+            void
+            refit() {
+                for (std::size_t k = nodes_.size(); k-- > 0;) {
+                    Node& n = nodes_[k];
+                    if (n.count > 0) {
+                        n.box = boxes_[indices_[n.first]];
+                        for (std::size_t i = n.first + 1; i < n.first + n.count; i++) {
+                            n.box |= boxes_[indices_[i]];
+                        }
+                    } else {
+                        n.box = nodes_[n.first].box | nodes_[n.first + 1].box;
+                    }
+                }
+            }
+
+            // Twice the box center along an axis, which stays integral.
+            std::int64_t
+            center(std::size_t i, std::size_t axis) const {
+                const tridimensional::Box<T>& b = boxes_[i];
+                switch (axis) {
+                    case 0:     return std::int64_t{static_cast<std::int32_t>(b.lower().x())} + static_cast<std::int32_t>(b.upper().x());
+                    case 1:     return std::int64_t{static_cast<std::int32_t>(b.lower().y())} + static_cast<std::int32_t>(b.upper().y());
+                    default:    return std::int64_t{static_cast<std::int32_t>(b.lower().z())} + static_cast<std::int32_t>(b.upper().z());
+                }
+            }
+
+            // Partitions indices_[begin, end) around the cheapest binned
+            // split, or returns nothing when the range should be a leaf.
+            std::optional<std::size_t>
+            split(std::size_t begin, std::size_t end) {
+                std::size_t count = end - begin;
+                if (count <= leaf) { return std::nullopt; }
+
+                std::array<std::int64_t, 3> lo;
+                std::array<std::int64_t, 3> hi;
+                lo.fill(std::numeric_limits<std::int64_t>::max());
+                hi.fill(std::numeric_limits<std::int64_t>::min());
+                for (std::size_t i = begin; i < end; i++) {
+                    for (std::size_t axis = 0; axis < 3; axis++) {
+                        lo[axis] = std::min(lo[axis], center(indices_[i], axis));
+                        hi[axis] = std::max(hi[axis], center(indices_[i], axis));
+                    }
+                }
+
+                std::size_t axis = 0;
+                for (std::size_t a = 1; a < 3; a++) {
+                    if ((hi[a] - lo[a]) > (hi[axis] - lo[axis])) { axis = a; }
+                }
+                std::int64_t extent = hi[axis] - lo[axis];
+                if (extent == 0) { return median(begin, end, axis); }
+
+                auto bin = [&](std::size_t i) {
+                    return static_cast<std::size_t>(((center(i, axis) - lo[axis]) * bins) / (extent + 1));
+                };
+
+                std::array<tridimensional::Box<T>, bins> boxes;
+                std::array<std::size_t, bins> counts = {};
+                for (std::size_t i = begin; i < end; i++) {
+                    std::size_t k = bin(indices_[i]);
+                    boxes[k] = counts[k] > 0 ? (boxes[k] | boxes_[indices_[i]]) : boxes_[indices_[i]];
+                    counts[k]++;
+                }
+
+                std::array<double, bins> left = {};
+                tridimensional::Box<T> sweep;
+                std::size_t total = 0;
+                for (std::size_t k = 0; k + 1 < bins; k++) {
+                    if (counts[k] > 0) { sweep = total > 0 ? (sweep | boxes[k]) : boxes[k]; }
+                    total += counts[k];
+                    left[k] = sweep.area() * static_cast<double>(total);
+                }
+
+                double      best    = std::numeric_limits<double>::max();
+                std::size_t choice  = 0;
+                total = 0;
+                for (std::size_t k = bins - 1; k > 0; k--) {
+                    if (counts[k] > 0) { sweep = total > 0 ? (sweep | boxes[k]) : boxes[k]; }
+                    total += counts[k];
+                    if (total == 0 or total == count) { continue; }
+
+                    double cost = left[k - 1] + (sweep.area() * static_cast<double>(total));
+                    if (cost < best) { best = cost; choice = k; }
+                }
+                if (choice == 0) { return median(begin, end, axis); }
+
+                auto middle = std::partition(
+                          indices_.begin() + begin
+                        , indices_.begin() + end
+                        , [&](std::size_t i) { return bin(i) < choice; }
+                        );
+                return static_cast<std::size_t>(middle - indices_.begin());
+            }
+
+            std::size_t
+            median(std::size_t begin, std::size_t end, std::size_t axis) {
+                std::size_t middle = begin + ((end - begin) / 2);
+                std::nth_element(
+                          indices_.begin() + begin
+                        , indices_.begin() + middle
+                        , indices_.begin() + end
+                        , [&](std::size_t i, std::size_t j) { return center(i, axis) < center(j, axis); }
+                        );
+                return middle;
+            }
+
+            std::vector<tridimensional::Box<T>> boxes_;
+            std::vector<std::size_t>            indices_;
+            std::vector<Node>                   nodes_;
+    };
+} // namespace collision
+} // namespace paulista
+
+#endif // PAULISTA_BVH_HPP__
@@ -0,0 +1,142 @@
+#ifndef PAULISTA_CACHE_HPP__
+#define PAULISTA_CACHE_HPP__
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "paulista-collision.hpp"
+#include "paulista-distance.hpp"
+#include "paulista-point.hpp"
+
+namespace paulista {
+namespace collision {
+    // Search directions of shape pairs kept from one frame to the next,
+    // keyed by the ids the caller gives the two shapes of a pair, in
+    // order. Queries through the cache start from the direction left by
+    // the last query on their pair, so pairs still apart along it are
+    // settled with a single support point per shape.
+    //
+    // Slots are grouped in buckets of four a pair hashes to. A pair not
+    // queried for more than lifetime frames is stale and its slot goes to
+    // the next pair needing one, so eviction costs nothing, and a full
+    // bucket gives up its least recently queried pair. A cache is meant to
+    // be used by one thread at a time.
+    template <typename T>
+    class Cache {
+        static_assert(dimension::is_dimension<T>::value);
+        public:
+            static constexpr std::size_t ways = 4;
+
+            explicit Cache(std::size_t capacity = 4096, std::uint64_t lifetime = 1)
+                : frame_(1)
+                , lifetime_(lifetime)
+                , slots_(std::bit_ceil(std::max(capacity, ways)))
+            {}
+
+            // Starts the next frame.
+            void            tick()              { frame_++; }
+            void            clear()             { slots_.assign(slots_.size(), Slot{}); }
+            std::uint64_t   frame() const       { return frame_; }
+            std::size_t     capacity() const    { return slots_.size(); }
+
+            // Number of pairs that are not stale.
+            std::size_t
+            size() const {
+                return std::count_if(slots_.begin(), slots_.end(), [this](const Slot& s) { return live(s); });
+            }
+
+            // Direction left for the pair (i, j), unless it is stale.
+            std::optional<tridimensional::Vector<T>>
+            axis(std::uint32_t i, std::uint32_t j) const {
+                std::uint64_t k = key(i, j);
+                const Slot* b = &slots_[bucket(k)];
+                for (std::size_t w = 0; w < ways; w++) {
+                    if (b[w].key == k and live(b[w])) { return b[w].axis; }
+                }
+                return std::nullopt;
+            }
+
+            void
+            store(std::uint32_t i, std::uint32_t j, const tridimensional::Vector<T>& axis) {
+                std::uint64_t k = key(i, j);
+                Slot* b = &slots_[bucket(k)];
+                Slot* victim = b;
+                for (std::size_t w = 0; w < ways; w++) {
+                    if (b[w].key == k and b[w].frame != 0) { victim = &b[w]; break; }
+                    if (b[w].frame < victim->frame) { victim = &b[w]; }
+                }
+                *victim = Slot{k, frame_, axis};
+            }
+        private:
+            // Frame 0 marks a slot that never held a pair.
+            struct Slot {
+                std::uint64_t               key     = 0;
+                std::uint64_t               frame   = 0;
+                tridimensional::Vector<T>   axis    = {};
+            };
+
+            static std::uint64_t
+            key(std::uint32_t i, std::uint32_t j) {
+                return (std::uint64_t{i} << 32) | j;
+            }
+
+            std::size_t
+            bucket(std::uint64_t k) const {
+                std::uint64_t h = k * 0x9e3779b97f4a7c15ull;
+                return static_cast<std::size_t>((h ^ (h >> 29)) & ((slots_.size() / ways) - 1)) * ways;
+            }
+
+            bool
+            live(const Slot& s) const {
+                return (s.frame != 0) and (frame_ - s.frame <= lifetime_);
+            }
+
+            std::uint64_t       frame_;
+            std::uint64_t       lifetime_;
+            std::vector<Slot>   slots_;
+    };
+
+    // detect on the pair (i, j), starting from its cached direction and
+    // caching the one it ends with.
+    template <SupportMappable X, SupportMappable Y>
+        requires std::same_as<typename X::value_type, typename Y::value_type>
+    inline std::optional<bool>
+    detect(const X& xs, const Y& ys, Cache<detail::unit_of<X>>& cache, std::uint32_t i, std::uint32_t j) {
+        using T = detail::unit_of<X>;
+
+        if (detail::empty(xs) or detail::empty(ys)) {
+            return std::nullopt;
+        } else {
+            auto ignore = [](const tridimensional::Point<T>&, const tridimensional::Point<T>&) {};
+            tridimensional::Vector<T> axis = cache.axis(i, j).value_or(tridimensional::Vector<T>());
+            bool intersecting = detail::gjk<T>(xs, ys, ignore, axis).has_value();
+            cache.store(i, j, axis);
+            return intersecting;
+        }
+    }
+
+    // distance on the pair (i, j), starting from its cached direction and
+    // caching the one it ends with.
+    template <SupportMappable X, SupportMappable Y>
+        requires std::same_as<typename X::value_type, typename Y::value_type>
+    inline std::optional<Separation>
+    distance(const X& xs, const Y& ys, Cache<detail::unit_of<X>>& cache, std::uint32_t i, std::uint32_t j) {
+        using T = detail::unit_of<X>;
+
+        if (detail::empty(xs) or detail::empty(ys)) {
+            return std::nullopt;
+        } else {
+            tridimensional::Vector<T> axis = cache.axis(i, j).value_or(tridimensional::Vector<T>());
+            std::optional<Separation> s = detail::separation<T>(xs, ys, axis);
+            cache.store(i, j, axis);
+            return s;
+        }
+    }
+} // namespace collision
+} // namespace paulista
+
+#endif // PAULISTA_CACHE_HPP__
@@ -0,0 +1,751 @@
+#ifndef PAULISTA_CLOUD_HPP__
+#define PAULISTA_CLOUD_HPP__
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <optional>
+#include <span>
+#include <vector>
+
+#if defined(__x86_64__) or defined(__i386__)
+#include <immintrin.h>
+#endif
+
+#include "paulista-point.hpp"
+
+namespace paulista {
+namespace tridimensional {
+namespace cloud {
+namespace detail {
+    constexpr std::size_t alignment = 32;
+    constexpr std::size_t width     = 8;
+
+    template <typename T>
+    struct Aligned {
+        using value_type = T;
+
+        Aligned() = default;
+
+        template <typename U>
+        Aligned(const Aligned<U>&) {}
+
+        T*
+        allocate(std::size_t n) {
+            return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t{alignment}));
+        }
+
+        void
+        deallocate(T* p, std::size_t) {
+            ::operator delete(p, std::align_val_t{alignment});
+        }
+
+        template <typename U>
+        friend bool
+        operator==(const Aligned<T>&, const Aligned<U>&) { return true; }
+    };
+
+    using Lane = std::vector<std::int32_t, Aligned<std::int32_t>>;
+
+    // Largest absolute coordinate of p, which for the most negative
+    // coordinate only fits unsigned.
+    template <typename T>
+    inline std::uint32_t
+    reach(const Point<T>& p) {
+        auto magnitude = [](T c) {
+            std::int64_t v = static_cast<std::int32_t>(c);
+            return static_cast<std::uint32_t>(v < 0 ? -v : v);
+        };
+        return std::max({magnitude(p.x()), magnitude(p.y()), magnitude(p.z())});
+    }
+} // namespace detail
+} // namespace cloud
+
+    // Structure of arrays point storage. Each coordinate array is 32 byte
+    // aligned and padded to a multiple of eight entries with copies of the
+    // first point, so vector kernels never need a scalar tail. The largest
+    // absolute coordinate is kept as points are added, so searches know
+    // when 64-bit dot products are exact.
+    template <typename T>
+    class PointCloud {
+        static_assert(dimension::is_dimension<T>::value);
+        public:
+            using value_type = Point<T>;
+
+            PointCloud() : size_(0), reach_(0) {}
+
+            explicit PointCloud(const std::vector<Point<T>>& ps) : size_(0), reach_(0) {
+                reserve(ps.size());
+                for (const Point<T>& p : ps) { push_back(p); }
+            }
+
+            friend bool
+            operator==(const PointCloud<T>& lhs, const PointCloud<T>& rhs) {
+                return  (lhs.size_ == rhs.size_)
+                    and (lhs.x_ == rhs.x_)
+                    and (lhs.y_ == rhs.y_)
+                    and (lhs.z_ == rhs.z_)
+                    ;
+            }
+
+            friend bool
+            operator!=(const PointCloud<T>& lhs, const PointCloud<T>& rhs) {
+                return not (lhs == rhs);
+            }
+
+            Point<T>
+            operator[](std::size_t i) const {
+                return Point<T>(x_[i], y_[i], z_[i]);
+            }
+
+            void
+            reserve(std::size_t n) {
+                std::size_t padded = round(n);
+                x_.reserve(padded);
+                y_.reserve(padded);
+                z_.reserve(padded);
+            }
+
+            void
+            push_back(const Point<T>& p) {
+                if (size_ == x_.size()) {
+                    Point<T> pad = (size_ == 0) ? p : (*this)[0];
+
+                    x_.resize(size_ + cloud::detail::width, static_cast<std::int32_t>(pad.x()));
+                    y_.resize(size_ + cloud::detail::width, static_cast<std::int32_t>(pad.y()));
+                    z_.resize(size_ + cloud::detail::width, static_cast<std::int32_t>(pad.z()));
+                }
+                x_[size_] = static_cast<std::int32_t>(p.x());
+                y_[size_] = static_cast<std::int32_t>(p.y());
+                z_[size_] = static_cast<std::int32_t>(p.z());
+                size_++;
+                reach_ = std::max(reach_, cloud::detail::reach(p));
+            }
+
+            bool            empty() const   { return size_ == 0; }
+            std::size_t     size() const    { return size_; }
+            std::size_t     padded() const  { return x_.size(); }
+            std::uint32_t   reach() const   { return reach_; }
+
+            const std::int32_t* xs() const  { return x_.data(); }
+            const std::int32_t* ys() const  { return y_.data(); }
+            const std::int32_t* zs() const  { return z_.data(); }
+        private:
+            static std::size_t
+            round(std::size_t n) {
+                return ((n + cloud::detail::width - 1) / cloud::detail::width) * cloud::detail::width;
+            }
+
+            std::size_t         size_;
+            std::uint32_t       reach_;
+            cloud::detail::Lane x_;
+            cloud::detail::Lane y_;
+            cloud::detail::Lane z_;
+    };
+
+    // Non-owning view over coordinate arrays laid out like PointCloud ones:
+    // 32 byte aligned and padded to a multiple of eight entries with copies
+    // of a point of the cloud. No coordinate may be further than reach from
+    // zero; a view that does not know its reach takes the widest one, which
+    // only sends the longest directions to the scalar search.
+    template <typename T>
+    class PointCloudView {
+        static_assert(dimension::is_dimension<T>::value);
+        public:
+            using value_type = Point<T>;
+
+            PointCloudView() : size_(0), padded_(0), reach_(0), x_(nullptr), y_(nullptr), z_(nullptr) {}
+
+            PointCloudView(const PointCloud<T>& ps)
+                : size_(ps.size())
+                , padded_(ps.padded())
+                , reach_(ps.reach())
+                , x_(ps.xs())
+                , y_(ps.ys())
+                , z_(ps.zs())
+            {}
+
+            PointCloudView(
+                      const std::int32_t* xs
+                    , const std::int32_t* ys
+                    , const std::int32_t* zs
+                    , std::size_t size
+                    , std::size_t padded
+                    , std::uint32_t reach = std::uint32_t{1} << 31
+                    )
+                : size_(size)
+                , padded_(padded)
+                , reach_(reach)
+                , x_(xs)
+                , y_(ys)
+                , z_(zs)
+            {}
+
+            Point<T>
+            operator[](std::size_t i) const {
+                return Point<T>(x_[i], y_[i], z_[i]);
+            }
+
+            bool            empty() const   { return size_ == 0; }
+            std::size_t     size() const    { return size_; }
+            std::size_t     padded() const  { return padded_; }
+            std::uint32_t   reach() const   { return reach_; }
+
+            const std::int32_t* xs() const  { return x_; }
+            const std::int32_t* ys() const  { return y_; }
+            const std::int32_t* zs() const  { return z_; }
+        private:
+            std::size_t         size_;
+            std::size_t         padded_;
+            std::uint32_t       reach_;
+            const std::int32_t* x_;
+            const std::int32_t* y_;
+            const std::int32_t* z_;
+    };
+namespace cloud {
+namespace detail {
+    // Every kernel returns the first index holding the largest 64-bit dot
+    // product, so the vector paths agree with the scalar one on ties. The
+    // sum is exact for any 32-bit direction while coordinates stay within
+    // the +-2^29 collision domain, and for wider ones as long as exact
+    // holds; wide covers the rest.
+    using Kernel = std::size_t (*)(
+              const std::int32_t*
+            , const std::int32_t*
+            , const std::int32_t*
+            , std::size_t
+            , std::int32_t
+            , std::int32_t
+            , std::int32_t
+            );
+
+    inline std::size_t
+    scalar(
+              const std::int32_t* xs
+            , const std::int32_t* ys
+            , const std::int32_t* zs
+            , std::size_t n
+            , std::int32_t vx
+            , std::int32_t vy
+            , std::int32_t vz
+            )
+    {
+        std::size_t  choice  = 0;
+        std::int64_t maximum = std::numeric_limits<std::int64_t>::min();
+        for (std::size_t i = 0; i < n; i++) {
+            std::int64_t current    = (std::int64_t{xs[i]} * vx)
+                                    + (std::int64_t{ys[i]} * vy)
+                                    + (std::int64_t{zs[i]} * vz)
+                                    ;
+            if (current > maximum) { choice = i; maximum = current; }
+        }
+        return choice;
+    }
+
+    // Whether no dot product of the direction with a point within reach of
+    // zero can leave 64 bits. The bound takes at most 2^31 * 3 * 2^31, so
+    // it is itself computed without overflow.
+    inline bool
+    exact(std::uint32_t reach, std::int32_t vx, std::int32_t vy, std::int32_t vz) {
+        auto magnitude = [](std::int32_t c) {
+            std::int64_t v = c;
+            return static_cast<std::uint64_t>(v < 0 ? -v : v);
+        };
+        std::uint64_t bound = std::uint64_t{reach} * (magnitude(vx) + magnitude(vy) + magnitude(vz));
+        return bound <= static_cast<std::uint64_t>(std::numeric_limits<std::int64_t>::max());
+    }
+
+    // Same answers as scalar, summing in 128 bits like point::dot, for
+    // directions and points too long for exact.
+    inline std::size_t
+    wide(
+              const std::int32_t* xs
+            , const std::int32_t* ys
+            , const std::int32_t* zs
+            , std::size_t n
+            , std::int32_t vx
+            , std::int32_t vy
+            , std::int32_t vz
+            )
+    {
+        using point::int128;
+
+        std::size_t choice  = 0;
+        int128      maximum = 0;
+        for (std::size_t i = 0; i < n; i++) {
+            int128 current  = int128{std::int64_t{xs[i]} * vx}
+                            + int128{std::int64_t{ys[i]} * vy}
+                            + int128{std::int64_t{zs[i]} * vz}
+                            ;
+            if (i == 0 or current > maximum) { choice = i; maximum = current; }
+        }
+        return choice;
+    }
+
+    inline std::size_t
+    reduce(const std::int64_t* values, const std::int64_t* indices, std::size_t n) {
+        std::size_t choice = 0;
+        for (std::size_t i = 1; i < n; i++) {
+            if (values[i] > values[choice]) {
+                choice = i;
+            } else if (values[i] == values[choice] and indices[i] < indices[choice]) {
+                choice = i;
+            }
+        }
+        return static_cast<std::size_t>(indices[choice]);
+    }
+
+#if defined(__x86_64__) or defined(__i386__)
+    __attribute__((target("avx2")))
+    inline std::size_t
+    avx2(
+              const std::int32_t* xs
+            , const std::int32_t* ys
+            , const std::int32_t* zs
+            , std::size_t n
+            , std::int32_t vx
+            , std::int32_t vy
+            , std::int32_t vz
+            )
+    {
+        const __m256i wx    = _mm256_set1_epi64x(vx);
+        const __m256i wy    = _mm256_set1_epi64x(vy);
+        const __m256i wz    = _mm256_set1_epi64x(vz);
+        const __m256i step  = _mm256_set1_epi64x(width);
+
+        __m256i evens   = _mm256_set_epi64x(6, 4, 2, 0);
+        __m256i odds    = _mm256_set_epi64x(7, 5, 3, 1);
+        __m256i best[2] = {
+              _mm256_set1_epi64x(std::numeric_limits<std::int64_t>::min())
+            , _mm256_set1_epi64x(std::numeric_limits<std::int64_t>::min())
+            };
+        __m256i args[2] = {evens, odds};
+
+        for (std::size_t i = 0; i < n; i += width) {
+            __m256i x = _mm256_load_si256(reinterpret_cast<const __m256i*>(xs + i));
+            __m256i y = _mm256_load_si256(reinterpret_cast<const __m256i*>(ys + i));
+            __m256i z = _mm256_load_si256(reinterpret_cast<const __m256i*>(zs + i));
+
+            __m256i even = _mm256_add_epi64(
+                      _mm256_add_epi64(_mm256_mul_epi32(x, wx), _mm256_mul_epi32(y, wy))
+                    , _mm256_mul_epi32(z, wz)
+                    );
+            __m256i odd = _mm256_add_epi64(
+                      _mm256_add_epi64(
+                          _mm256_mul_epi32(_mm256_srli_epi64(x, 32), wx)
+                        , _mm256_mul_epi32(_mm256_srli_epi64(y, 32), wy)
+                        )
+                    , _mm256_mul_epi32(_mm256_srli_epi64(z, 32), wz)
+                    );
+
+            __m256i g0  = _mm256_cmpgt_epi64(even, best[0]);
+            __m256i g1  = _mm256_cmpgt_epi64(odd,  best[1]);
+            best[0]     = _mm256_blendv_epi8(best[0], even,  g0);
+            best[1]     = _mm256_blendv_epi8(best[1], odd,   g1);
+            args[0]     = _mm256_blendv_epi8(args[0], evens, g0);
+            args[1]     = _mm256_blendv_epi8(args[1], odds,  g1);
+
+            evens   = _mm256_add_epi64(evens, step);
+            odds    = _mm256_add_epi64(odds,  step);
+        }
+
+        alignas(alignment) std::int64_t values[width];
+        alignas(alignment) std::int64_t indices[width];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(values),      best[0]);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(values + 4),  best[1]);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(indices),     args[0]);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(indices + 4), args[1]);
+
+        return reduce(values, indices, width);
+    }
+
+    __attribute__((target("sse4.2")))
+    inline std::size_t
+    sse(
+              const std::int32_t* xs
+            , const std::int32_t* ys
+            , const std::int32_t* zs
+            , std::size_t n
+            , std::int32_t vx
+            , std::int32_t vy
+            , std::int32_t vz
+            )
+    {
+        const __m128i wx    = _mm_set1_epi64x(vx);
+        const __m128i wy    = _mm_set1_epi64x(vy);
+        const __m128i wz    = _mm_set1_epi64x(vz);
+        const __m128i step  = _mm_set1_epi64x(4);
+
+        __m128i evens   = _mm_set_epi64x(2, 0);
+        __m128i odds    = _mm_set_epi64x(3, 1);
+        __m128i best[2] = {
+              _mm_set1_epi64x(std::numeric_limits<std::int64_t>::min())
+            , _mm_set1_epi64x(std::numeric_limits<std::int64_t>::min())
+            };
+        __m128i args[2] = {evens, odds};
+
+        for (std::size_t i = 0; i < n; i += 4) {
+            __m128i x = _mm_load_si128(reinterpret_cast<const __m128i*>(xs + i));
+            __m128i y = _mm_load_si128(reinterpret_cast<const __m128i*>(ys + i));
+            __m128i z = _mm_load_si128(reinterpret_cast<const __m128i*>(zs + i));
+
+            __m128i even = _mm_add_epi64(
+                      _mm_add_epi64(_mm_mul_epi32(x, wx), _mm_mul_epi32(y, wy))
+                    , _mm_mul_epi32(z, wz)
+                    );
+            __m128i odd = _mm_add_epi64(
+                      _mm_add_epi64(
+                          _mm_mul_epi32(_mm_srli_epi64(x, 32), wx)
+                        , _mm_mul_epi32(_mm_srli_epi64(y, 32), wy)
+                        )
+                    , _mm_mul_epi32(_mm_srli_epi64(z, 32), wz)
+                    );
+
+            __m128i g0  = _mm_cmpgt_epi64(even, best[0]);
+            __m128i g1  = _mm_cmpgt_epi64(odd,  best[1]);
+            best[0]     = _mm_blendv_epi8(best[0], even,  g0);
+            best[1]     = _mm_blendv_epi8(best[1], odd,   g1);
+            args[0]     = _mm_blendv_epi8(args[0], evens, g0);
+            args[1]     = _mm_blendv_epi8(args[1], odds,  g1);
+
+            evens   = _mm_add_epi64(evens, step);
+            odds    = _mm_add_epi64(odds,  step);
+        }
+
+        alignas(16) std::int64_t values[4];
+        alignas(16) std::int64_t indices[4];
+        _mm_store_si128(reinterpret_cast<__m128i*>(values),      best[0]);
+        _mm_store_si128(reinterpret_cast<__m128i*>(values + 2),  best[1]);
+        _mm_store_si128(reinterpret_cast<__m128i*>(indices),     args[0]);
+        _mm_store_si128(reinterpret_cast<__m128i*>(indices + 2), args[1]);
+
+        return reduce(values, indices, 4);
+    }
+#endif
+
+    // Directions a multi-direction kernel follows in one pass over the
+    // points; longer lists are taken in groups of this many.
+    constexpr std::size_t group = 16;
+
+    // Writes to out[j] the index the single direction kernels return for
+    // the direction (vx[j], vy[j], vz[j]), for every j below k <= group.
+    using Many = void (*)(
+              const std::int32_t*
+            , const std::int32_t*
+            , const std::int32_t*
+            , std::size_t
+            , const std::int32_t*
+            , const std::int32_t*
+            , const std::int32_t*
+            , std::size_t
+            , std::size_t*
+            );
+
+    inline void
+    scalar_many(
+              const std::int32_t* xs
+            , const std::int32_t* ys
+            , const std::int32_t* zs
+            , std::size_t n
+            , const std::int32_t* vx
+            , const std::int32_t* vy
+            , const std::int32_t* vz
+            , std::size_t k
+            , std::size_t* out
+            )
+    {
+        std::int64_t maxima[group];
+        for (std::size_t j = 0; j < k; j++) {
+            maxima[j]   = std::numeric_limits<std::int64_t>::min();
+            out[j]      = 0;
+        }
+        for (std::size_t i = 0; i < n; i++) {
+            std::int64_t x = xs[i];
+            std::int64_t y = ys[i];
+            std::int64_t z = zs[i];
+            for (std::size_t j = 0; j < k; j++) {
+                std::int64_t current = (x * vx[j]) + (y * vy[j]) + (z * vz[j]);
+                if (current > maxima[j]) { out[j] = i; maxima[j] = current; }
+            }
+        }
+    }
+
+#if defined(__x86_64__) or defined(__i386__)
+    // Directions avx2_many runs together, so that their six broadcast
+    // components, four running maxima and three coordinates take thirteen
+    // of the sixteen ymm registers, and points per block, which stay in
+    // L1 while every tile reads them.
+    constexpr std::size_t tile  = 2;
+    constexpr std::size_t block = 256;
+
+    // Writes to maxima[j] the largest dot product of the points in
+    // [begin, end) with the direction (vx[j], vy[j], vz[j]), for every j
+    // below K.
+    template <std::size_t K>
+    __attribute__((target("avx2")))
+    inline void
+    avx2_tile(
+              const std::int32_t* xs
+            , const std::int32_t* ys
+            , const std::int32_t* zs
+            , std::size_t begin
+            , std::size_t end
+            , const std::int32_t* vx
+            , const std::int32_t* vy
+            , const std::int32_t* vz
+            , std::int64_t* maxima
+            )
+    {
+        __m256i wx[K];
+        __m256i wy[K];
+        __m256i wz[K];
+        __m256i best[K][2];
+        for (std::size_t j = 0; j < K; j++) {
+            wx[j]       = _mm256_set1_epi64x(vx[j]);
+            wy[j]       = _mm256_set1_epi64x(vy[j]);
+            wz[j]       = _mm256_set1_epi64x(vz[j]);
+            best[j][0]  = best[j][1] = _mm256_set1_epi64x(std::numeric_limits<std::int64_t>::min());
+        }
+
+        // The even lanes of a block go through every direction before
+        // the odd ones, so only three coordinate registers are live.
+        for (std::size_t i = begin; i < end; i += width) {
+            __m256i x = _mm256_load_si256(reinterpret_cast<const __m256i*>(xs + i));
+            __m256i y = _mm256_load_si256(reinterpret_cast<const __m256i*>(ys + i));
+            __m256i z = _mm256_load_si256(reinterpret_cast<const __m256i*>(zs + i));
+
+#pragma GCC unroll 2
+            for (std::size_t half = 0; half < 2; half++) {
+#pragma GCC unroll 2
+                for (std::size_t j = 0; j < K; j++) {
+                    __m256i dot = _mm256_add_epi64(
+                              _mm256_add_epi64(_mm256_mul_epi32(x, wx[j]), _mm256_mul_epi32(y, wy[j]))
+                            , _mm256_mul_epi32(z, wz[j])
+                            );
+                    best[j][half] = _mm256_blendv_epi8(best[j][half], dot, _mm256_cmpgt_epi64(dot, best[j][half]));
+                }
+
+                x = _mm256_srli_epi64(x, 32);
+                y = _mm256_srli_epi64(y, 32);
+                z = _mm256_srli_epi64(z, 32);
+            }
+        }
+
+        alignas(alignment) std::int64_t values[width];
+        for (std::size_t j = 0; j < K; j++) {
+            _mm256_store_si256(reinterpret_cast<__m256i*>(values),      best[j][0]);
+            _mm256_store_si256(reinterpret_cast<__m256i*>(values + 4),  best[j][1]);
+            maxima[j] = *std::max_element(values, values + width);
+        }
+    }
+
+    // First index from begin whose dot product with (vx, vy, vz) equals
+    // target, which some point at or after begin is known to reach.
+    __attribute__((target("avx2")))
+    inline std::size_t
+    avx2_find(
+              const std::int32_t* xs
+            , const std::int32_t* ys
+            , const std::int32_t* zs
+            , std::size_t begin
+            , std::int32_t vx
+            , std::int32_t vy
+            , std::int32_t vz
+            , std::int64_t target
+            )
+    {
+        const __m256i wx    = _mm256_set1_epi64x(vx);
+        const __m256i wy    = _mm256_set1_epi64x(vy);
+        const __m256i wz    = _mm256_set1_epi64x(vz);
+        const __m256i goal  = _mm256_set1_epi64x(target);
+
+        for (std::size_t i = begin;; i += width) {
+            __m256i x = _mm256_load_si256(reinterpret_cast<const __m256i*>(xs + i));
+            __m256i y = _mm256_load_si256(reinterpret_cast<const __m256i*>(ys + i));
+            __m256i z = _mm256_load_si256(reinterpret_cast<const __m256i*>(zs + i));
+
+            __m256i even = _mm256_add_epi64(
+                      _mm256_add_epi64(_mm256_mul_epi32(x, wx), _mm256_mul_epi32(y, wy))
+                    , _mm256_mul_epi32(z, wz)
+                    );
+            __m256i odd = _mm256_add_epi64(
+                      _mm256_add_epi64(
+                          _mm256_mul_epi32(_mm256_srli_epi64(x, 32), wx)
+                        , _mm256_mul_epi32(_mm256_srli_epi64(y, 32), wy)
+                        )
+                    , _mm256_mul_epi32(_mm256_srli_epi64(z, 32), wz)
+                    );
+
+            unsigned evens  = static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(even, goal))));
+            unsigned odds   = static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(odd,  goal))));
+            if ((evens | odds) != 0) {
+                std::size_t e = evens != 0 ? 2 * static_cast<std::size_t>(std::countr_zero(evens))       : width;
+                std::size_t o = odds  != 0 ? 2 * static_cast<std::size_t>(std::countr_zero(odds)) + 1   : width;
+                return i + std::min(e, o);
+            }
+        }
+    }
+
+    // Same answers as avx2. The points are walked in blocks, and each
+    // block is run through the directions a tile at a time, so it is
+    // loaded from memory once while the maxima of a tile stay in
+    // registers. Only the block where each direction last improved is
+    // remembered, and rescanned at the end for the first point reaching
+    // its maximum, which keeps index tracking out of the inner loop.
+    __attribute__((target("avx2")))
+    inline void
+    avx2_many(
+              const std::int32_t* xs
+            , const std::int32_t* ys
+            , const std::int32_t* zs
+            , std::size_t n
+            , const std::int32_t* vx
+            , const std::int32_t* vy
+            , const std::int32_t* vz
+            , std::size_t k
+            , std::size_t* out
+            )
+    {
+        std::int64_t    maxima[group];
+        std::size_t     blocks[group];
+        for (std::size_t j = 0; j < k; j++) {
+            maxima[j] = std::numeric_limits<std::int64_t>::min();
+            blocks[j] = 0;
+        }
+
+        for (std::size_t begin = 0; begin < n; begin += block) {
+            std::size_t end = std::min(n, begin + block);
+            for (std::size_t j = 0; j < k; j += tile) {
+                std::int64_t local[tile];
+                std::size_t count = std::min(tile, k - j);
+                switch (count) {
+                    case 1:     avx2_tile<1>(xs, ys, zs, begin, end, vx + j, vy + j, vz + j, local); break;
+                    default:    avx2_tile<2>(xs, ys, zs, begin, end, vx + j, vy + j, vz + j, local); break;
+                }
+                for (std::size_t t = 0; t < count; t++) {
+                    if (local[t] > maxima[j + t]) {
+                        maxima[j + t] = local[t];
+                        blocks[j + t] = begin;
+                    }
+                }
+            }
+        }
+
+        for (std::size_t j = 0; j < k; j++) {
+            out[j] = avx2_find(xs, ys, zs, blocks[j], vx[j], vy[j], vz[j], maxima[j]);
+        }
+    }
+#endif
+
+    inline Many
+    dispatch_many() {
+        static const Many kernel = []() -> Many {
+#if defined(__x86_64__) or defined(__i386__)
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx2"))     { return avx2_many; }
+#endif
+            return scalar_many;
+        }();
+        return kernel;
+    }
+
+    inline Kernel
+    dispatch() {
+        static const Kernel kernel = []() -> Kernel {
+#if defined(__x86_64__) or defined(__i386__)
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx2"))     { return avx2; }
+            if (__builtin_cpu_supports("sse4.2"))   { return sse; }
+#endif
+            return scalar;
+        }();
+        return kernel;
+    }
+} // namespace detail
+
+    // First index of the point furthest along v, with the same answer as
+    // collision::support over the points in a span for any 32-bit points
+    // and direction. The vector kernels run whenever the reach of the
+    // cloud keeps their 64-bit sums exact, and an exact scalar scan
+    // otherwise.
+    template <typename T>
+    inline std::optional<std::size_t>
+    extreme(const PointCloudView<T>& ps, const Vector<T>& v) {
+        std::int32_t vx = static_cast<std::int32_t>(v.x());
+        std::int32_t vy = static_cast<std::int32_t>(v.y());
+        std::int32_t vz = static_cast<std::int32_t>(v.z());
+
+        if (ps.empty()) {
+            return std::nullopt;
+        } else if (detail::exact(ps.reach(), vx, vy, vz)) {
+            return detail::dispatch()(ps.xs(), ps.ys(), ps.zs(), ps.padded(), vx, vy, vz);
+        } else {
+            return detail::wide(ps.xs(), ps.ys(), ps.zs(), ps.size(), vx, vy, vz);
+        }
+    }
+
+    template <typename T>
+    inline std::optional<std::size_t>
+    extreme(const PointCloud<T>& ps, const Vector<T>& v) {
+        return extreme(PointCloudView<T>(ps), v);
+    }
+
+    // Index extreme returns for each direction, written at the index of
+    // its direction, reading the points once per group of directions that
+    // the vector kernels take exactly, and once more for every other one.
+    // Returns false, writing nothing, for an empty cloud.
+    template <typename T>
+    inline bool
+    extremes(const PointCloudView<T>& ps, std::span<const Vector<T>> vs, std::span<std::size_t> out) {
+        if (ps.empty()) {
+            return false;
+        } else {
+            std::size_t n = std::min(vs.size(), out.size());
+            for (std::size_t first = 0; first < n; first += detail::group) {
+                std::size_t k = std::min(detail::group, n - first);
+
+                std::int32_t vx[detail::group];
+                std::int32_t vy[detail::group];
+                std::int32_t vz[detail::group];
+                std::size_t  where[detail::group];
+                std::size_t  m = 0;
+                for (std::size_t j = 0; j < k; j++) {
+                    std::int32_t x = static_cast<std::int32_t>(vs[first + j].x());
+                    std::int32_t y = static_cast<std::int32_t>(vs[first + j].y());
+                    std::int32_t z = static_cast<std::int32_t>(vs[first + j].z());
+                    if (detail::exact(ps.reach(), x, y, z)) {
+                        vx[m]       = x;
+                        vy[m]       = y;
+                        vz[m]       = z;
+                        where[m]    = first + j;
+                        m++;
+                    } else {
+                        out[first + j] = detail::wide(ps.xs(), ps.ys(), ps.zs(), ps.size(), x, y, z);
+                    }
+                }
+
+                if (m == k) {
+                    detail::dispatch_many()(ps.xs(), ps.ys(), ps.zs(), ps.padded(), vx, vy, vz, k, out.data() + first);
+                } else if (m > 0) {
+                    std::size_t found[detail::group];
+                    detail::dispatch_many()(ps.xs(), ps.ys(), ps.zs(), ps.padded(), vx, vy, vz, m, found);
+                    for (std::size_t j = 0; j < m; j++) { out[where[j]] = found[j]; }
+                }
+            }
+            return true;
+        }
+    }
+
+    template <typename T>
+    inline bool
+    extremes(const PointCloud<T>& ps, std::span<const Vector<T>> vs, std::span<std::size_t> out) {
+        return extremes(PointCloudView<T>(ps), vs, out);
+    }
+} // namespace cloud
+} // namespace tridimensional
+} // namespace paulista
+
+#endif // PAULISTA_CLOUD_HPP__
@@ -1,36 +1,647 @@
 #ifndef PAULISTA_COLLISION_HPP__
 #define PAULISTA_COLLISION_HPP__
 
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <memory_resource>
 #include <optional>
+#include <span>
+#include <utility>
+#include <variant>
+#include <vector>
 
+#include "paulista-cloud.hpp"
+#include "paulista-parallel.hpp"
 #include "paulista-point.hpp"
 #include "paulista-simplex.hpp"
+#include "paulista-statistics.hpp"
 
 namespace paulista {
 namespace collision {
-    using Shape = std::vector<tridimensional::Point>;
+    template <typename T>
+    using Shape = std::vector<tridimensional::Point<T>>;
 
-    inline std::optional<tridimensional::Point>
-    support(const Shape& ps, const tridimensional::Vector& v) {
+namespace pmr {
+    template <typename T>
+    using Shape = std::pmr::vector<tridimensional::Point<T>>;
+} // namespace pmr
+
+namespace detail {
+    template <typename P>
+    struct unit;
+
+    template <typename T>
+    struct unit<tridimensional::Point<T>> { using type = T; };
+
+    template <typename S>
+    using unit_of = typename unit<typename S::value_type>::type;
+
+    // Coordinates are expected to lie within +-domain, so that Minkowski
+    // difference vertices fit in 31 bits and search directions scaled to
+    // +-bound keep every dot product within 64 bits.
+    constexpr std::int32_t  domain      = 1 << 29;
+    constexpr double        bound       = 1 << 30;
+    constexpr std::size_t   iterations  = 64;
+
+    // Relative gap between the upper and lower bounds on a distance at
+    // which the closest feature of a simplex is accepted.
+    constexpr double        tolerance   = 1e-12;
+
+    using tridimensional::point::int128;
+
+    template <typename T>
+    inline bool
+    inside(const tridimensional::Point<T>& p) {
+        auto within = [](T c) { return -domain <= static_cast<std::int32_t>(c) and static_cast<std::int32_t>(c) <= domain; };
+        return within(p.x()) and within(p.y()) and within(p.z());
+    }
+
+    // Vertex x - y of the Minkowski difference, which fits the unit type
+    // only while both points lie in the domain.
+    template <typename T>
+    inline tridimensional::Point<T>
+    difference(const tridimensional::Point<T>& x, const tridimensional::Point<T>& y) {
+        assert(inside(x) and inside(y));
+        return x - y;
+    }
+
+    struct Wide {
+        int128 x;
+        int128 y;
+        int128 z;
+
+        friend Wide
+        operator-(const Wide& lhs, const Wide& rhs) {
+            return {lhs.x - rhs.x, lhs.y - rhs.y, lhs.z - rhs.z};
+        }
+
+        bool
+        zero() const {
+            return (x == 0) and (y == 0) and (z == 0);
+        }
+
+        int128
+        dot(const Wide& lhs) const {
+            return (x * lhs.x) + (y * lhs.y) + (z * lhs.z);
+        }
+
+        Wide
+        cross(const Wide& lhs) const {
+            return {
+                  (y * lhs.z) - (z * lhs.y)
+                , (z * lhs.x) - (x * lhs.z)
+                , (x * lhs.y) - (y * lhs.x)
+                };
+        }
+    };
+
+    struct Real {
+        double x;
+        double y;
+        double z;
+
+        friend Real
+        operator+(const Real& lhs, const Real& rhs) {
+            return {lhs.x + rhs.x, lhs.y + rhs.y, lhs.z + rhs.z};
+        }
+
+        friend Real
+        operator-(const Real& lhs, const Real& rhs) {
+            return {lhs.x - rhs.x, lhs.y - rhs.y, lhs.z - rhs.z};
+        }
+
+        friend Real
+        operator-(const Real& rhs) {
+            return {-rhs.x, -rhs.y, -rhs.z};
+        }
+
+        friend Real
+        operator*(const Real& lhs, double value) {
+            return {lhs.x * value, lhs.y * value, lhs.z * value};
+        }
+
+        double
+        dot(const Real& lhs) const {
+            return (x * lhs.x) + (y * lhs.y) + (z * lhs.z);
+        }
+    };
+
+    template <typename T>
+    inline Wide
+    widen(const tridimensional::Point<T>& p) {
+        return {
+              static_cast<std::int32_t>(p.x())
+            , static_cast<std::int32_t>(p.y())
+            , static_cast<std::int32_t>(p.z())
+            };
+    }
+
+    template <typename T>
+    inline Real
+    real(const tridimensional::Point<T>& p) {
+        return {
+              static_cast<double>(static_cast<std::int32_t>(p.x()))
+            , static_cast<double>(static_cast<std::int32_t>(p.y()))
+            , static_cast<double>(static_cast<std::int32_t>(p.z()))
+            };
+    }
+
+    // Scales a direction so that its largest component is +-2^30.
+    template <typename T>
+    inline tridimensional::Vector<T>
+    narrow(const Real& v) {
+        double m = std::max({std::abs(v.x), std::abs(v.y), std::abs(v.z)});
+        if (m == 0.0) {
+            return tridimensional::Vector<T>();
+        } else {
+            double scale = bound / m;
+            return tridimensional::Vector<T>(
+                      static_cast<std::int32_t>(std::llround(v.x * scale))
+                    , static_cast<std::int32_t>(std::llround(v.y * scale))
+                    , static_cast<std::int32_t>(std::llround(v.z * scale))
+                    );
+        }
+    }
+
+    template <typename T>
+    struct Step {
+        Simplex<T>  simplex;
+        Real        closest;
+        bool        contains;
+    };
+
+    template <typename T>
+    inline Step<T>
+    nearest(const tridimensional::Point<T>& a) {
+        return {simplex::Point<T>{a}, real(a), false};
+    }
+
+    template <typename T>
+    inline Step<T>
+    nearest(const tridimensional::Point<T>& a, const tridimensional::Point<T>& b) {
+        Real ab = real(b) - real(a);
+        double t = -real(a).dot(ab);
+        double d = ab.dot(ab);
+
+        if (t <= 0.0) {
+            return nearest(a);
+        } else if (t >= d) {
+            return nearest(b);
+        } else {
+            return {simplex::Line<T>{a, b}, real(a) + ab * (t / d), false};
+        }
+    }
+
+    template <typename T>
+    inline Step<T>
+    nearest(
+              const tridimensional::Point<T>& a
+            , const tridimensional::Point<T>& b
+            , const tridimensional::Point<T>& c
+            )
+    {
+        Real ab = real(b) - real(a);
+        Real ac = real(c) - real(a);
+
+        double d1 = -ab.dot(real(a));
+        double d2 = -ac.dot(real(a));
+        if (d1 <= 0.0 and d2 <= 0.0) { return nearest(a); }
+
+        double d3 = -ab.dot(real(b));
+        double d4 = -ac.dot(real(b));
+        if (d3 >= 0.0 and d4 <= d3) { return nearest(b); }
+
+        double d5 = -ab.dot(real(c));
+        double d6 = -ac.dot(real(c));
+        if (d6 >= 0.0 and d5 <= d6) { return nearest(c); }
+
+        double vc = (d1 * d4) - (d3 * d2);
+        if (vc <= 0.0 and d1 >= 0.0 and d3 <= 0.0) { return nearest(a, b); }
+
+        double vb = (d5 * d2) - (d1 * d6);
+        if (vb <= 0.0 and d2 >= 0.0 and d6 <= 0.0) { return nearest(a, c); }
+
+        double va = (d3 * d6) - (d5 * d4);
+        if (va <= 0.0 and (d4 - d3) >= 0.0 and (d5 - d6) >= 0.0) { return nearest(b, c); }
+
+        double denominator = va + vb + vc;
+        if (denominator <= 0.0) {
+            Step<T> step = nearest(a, b);
+            for (Step<T> candidate : {nearest(a, c), nearest(b, c)}) {
+                if (candidate.closest.dot(candidate.closest) < step.closest.dot(step.closest)) {
+                    step = candidate;
+                }
+            }
+            return step;
+        }
+
+        Real closest = real(a) + (ab * (vb / denominator)) + (ac * (vc / denominator));
+        return {simplex::Triangle<T>{a, b, c}, closest, false};
+    }
+
+    template <typename T>
+    inline Step<T>
+    nearest(
+              const tridimensional::Point<T>& a
+            , const tridimensional::Point<T>& b
+            , const tridimensional::Point<T>& c
+            , const tridimensional::Point<T>& d
+            )
+    {
+        const tridimensional::Point<T> origin;
+
+        // The origin is outside a face when it lies strictly on the other
+        // side of it than the opposite vertex; a flat tetrahedron has every
+        // face as a candidate.
+        auto outside = [&origin](
+                  const tridimensional::Point<T>& u
+                , const tridimensional::Point<T>& v
+                , const tridimensional::Point<T>& w
+                , const tridimensional::Point<T>& z
+                )
+        {
+            int apex = tridimensional::point::orient3d(u, v, w, z);
+            int side = tridimensional::point::orient3d(u, v, w, origin);
+
+            return (apex == 0) or (apex > 0 and side < 0) or (apex < 0 and side > 0);
+        };
+
+        std::optional<Step<T>> step = std::nullopt;
+        auto consider = [&step](const Step<T>& candidate) {
+            if (not step or candidate.closest.dot(candidate.closest) < step->closest.dot(step->closest)) {
+                step = candidate;
+            }
+        };
+
+        if (outside(a, b, c, d)) { consider(nearest(a, b, c)); }
+        if (outside(a, c, d, b)) { consider(nearest(a, c, d)); }
+        if (outside(a, d, b, c)) { consider(nearest(a, d, b)); }
+        if (outside(b, c, d, a)) { consider(nearest(b, c, d)); }
+
+        if (step) {
+            return *step;
+        } else {
+            return {simplex::Tetrahedron<T>{a, b, c, d}, Real{0.0, 0.0, 0.0}, true};
+        }
+    }
+
+    // Barycentric weights of the point of the simplex nearest to q.
+    inline std::array<double, 3>
+    weights(const std::array<Real, 3>& ps, std::size_t count, const Real& q) {
+        if (count == 1) {
+            return {1.0, 0.0, 0.0};
+        } else if (count == 2) {
+            Real ab = ps[1] - ps[0];
+            double d = ab.dot(ab);
+            double t = d == 0.0 ? 0.0 : std::clamp((q - ps[0]).dot(ab) / d, 0.0, 1.0);
+            return {1.0 - t, t, 0.0};
+        } else {
+            Real v0 = ps[1] - ps[0];
+            Real v1 = ps[2] - ps[0];
+            Real v2 = q - ps[0];
+
+            double d00 = v0.dot(v0);
+            double d01 = v0.dot(v1);
+            double d11 = v1.dot(v1);
+            double d20 = v2.dot(v0);
+            double d21 = v2.dot(v1);
+
+            double denominator = (d00 * d11) - (d01 * d01);
+            if (denominator == 0.0) { return weights(ps, 2, q); }
+
+            double v = ((d11 * d20) - (d01 * d21)) / denominator;
+            double w = ((d00 * d21) - (d01 * d20)) / denominator;
+            return {1.0 - v - w, v, w};
+        }
+    }
+
+    template <typename T>
+    struct evolve {
+        tridimensional::Point<T> a;
+
+        Step<T> operator()(const simplex::Point<T>& s) const         { return nearest(a, s.u); }
+        Step<T> operator()(const simplex::Line<T>& s) const          { return nearest(a, s.u, s.v); }
+        Step<T> operator()(const simplex::Triangle<T>& s) const      { return nearest(a, s.u, s.v, s.w); }
+        Step<T> operator()(const simplex::Tetrahedron<T>& s) const   { return nearest(a, s.u, s.v, s.w); }
+    };
+
+    template <typename T>
+    struct has_vertex {
+        tridimensional::Point<T> a;
+
+        bool operator()(const simplex::Point<T>& s) const        { return a == s.u; }
+        bool operator()(const simplex::Line<T>& s) const         { return a == s.u or a == s.v; }
+        bool operator()(const simplex::Triangle<T>& s) const     { return a == s.u or a == s.v or a == s.w; }
+        bool operator()(const simplex::Tetrahedron<T>& s) const  { return a == s.u or a == s.v or a == s.w or a == s.z; }
+    };
+
+    // Minkowski difference vertex along with the points of either shape
+    // it came from.
+    template <typename T>
+    struct Vertex {
+        tridimensional::Point<T> a;
+        tridimensional::Point<T> x;
+        tridimensional::Point<T> y;
+    };
+
+    template <typename T>
+    struct Corners {
+        std::array<tridimensional::Point<T>, 4> points;
+        std::size_t                             count;
+    };
+
+    template <typename T>
+    struct corners {
+        Corners<T> operator()(const simplex::Point<T>& s) const         { return {{s.u}, 1}; }
+        Corners<T> operator()(const simplex::Line<T>& s) const          { return {{s.u, s.v}, 2}; }
+        Corners<T> operator()(const simplex::Triangle<T>& s) const      { return {{s.u, s.v, s.w}, 3}; }
+        Corners<T> operator()(const simplex::Tetrahedron<T>& s) const   { return {{s.u, s.v, s.w, s.z}, 4}; }
+    };
+} // namespace detail
+
+    template <typename T>
+    inline std::optional<tridimensional::Point<T>>
+    support(std::span<const tridimensional::Point<T>> ps, const tridimensional::Vector<T>& v) {
         if (ps.empty()) {
             return std::nullopt;
         } else {
-            tridimensional::Point choice = ps.front();
-            for (const tridimensional::Point& p : ps) {
-                if (p.dot(v) > choice.dot(v)) { choice = p; }
+            tridimensional::Point<T> choice = ps.front();
+            tridimensional::point::int128 maximum = tridimensional::point::dot(choice, v);
+            for (const tridimensional::Point<T>& p : ps) {
+                tridimensional::point::int128 current = tridimensional::point::dot(p, v);
+                if (current > maximum) { choice = p; maximum = current; }
             }
             return choice;
         }
     }
 
-    inline std::optional<bool>
-    detect(const Shape& xs, const Shape& ys) {
-        if (xs.empty() or ys.empty()) {
+    template <typename T, typename A>
+    inline std::optional<tridimensional::Point<T>>
+    support(const std::vector<tridimensional::Point<T>, A>& ps, const tridimensional::Vector<T>& v) {
+        return support(std::span<const tridimensional::Point<T>>(ps), v);
+    }
+
+    // Same point as support over a span of the same points, for any 32-bit
+    // coordinates and direction; see cloud::extreme.
+    template <typename T>
+    inline std::optional<tridimensional::Point<T>>
+    support(const tridimensional::PointCloudView<T>& ps, const tridimensional::Vector<T>& v) {
+        std::optional<std::size_t> i = tridimensional::cloud::extreme(ps, v);
+        if (not i) {
+            return std::nullopt;
+        } else {
+            return ps[*i];
+        }
+    }
+
+    template <typename T>
+    inline std::optional<tridimensional::Point<T>>
+    support(const tridimensional::PointCloud<T>& ps, const tridimensional::Vector<T>& v) {
+        return support(tridimensional::PointCloudView<T>(ps), v);
+    }
+
+    // Shapes the queries run on: anything whose points, of the type it
+    // names value_type, are reached through a support function found by
+    // ordinary or argument dependent lookup. Shapes that may be empty tell
+    // through an empty() member; any other holds at least one point.
+    template <typename S>
+    concept SupportMappable = requires (const S& s, const tridimensional::Vector<detail::unit_of<S>>& v) {
+        { support(s, v) } -> std::same_as<std::optional<typename S::value_type>>;
+    };
+
+    template <SupportMappable X, SupportMappable Y, typename T>
+    inline std::optional<tridimensional::Point<T>>
+    support(const X& xs, const Y& ys, const tridimensional::Vector<T>& v) {
+        std::optional<tridimensional::Point<T>> x = support(xs,  v);
+        std::optional<tridimensional::Point<T>> y = support(ys, -v);
+
+        if (not x or not y) {
             return std::nullopt;
+        } else {
+            return detail::difference(*x, *y);
+        }
+    }
+
+namespace detail {
+    template <typename X>
+    inline bool
+    empty(const X& xs) {
+        if constexpr (requires { xs.empty(); }) {
+            return xs.empty();
         } else {
             return false;
         }
     }
+
+    // Point of a shape to start iterating from: its first point for shapes
+    // holding points, its support point along +x for any other.
+    template <typename T, typename X>
+    inline tridimensional::Point<T>
+    start(const X& xs) {
+        if constexpr (requires { xs[0]; }) {
+            return xs[0];
+        } else {
+            return *support(xs, tridimensional::Vector<T>(1, 0, 0));
+        }
+    }
+
+    // Runs GJK over the Minkowski difference xs - ys, calling record(x, y)
+    // with the points of either shape behind every support point. Returns
+    // the terminal step, or nothing once the shapes are proven disjoint.
+    // A non-zero axis is tried as a separating direction before anything
+    // else and seeds the simplex otherwise; on return it holds the last
+    // search direction, which separates the shapes when they are disjoint.
+    template <typename T, typename X, typename Y, typename F>
+    inline std::optional<Step<T>>
+    gjk(const X& xs, const Y& ys, F&& record, tridimensional::Vector<T>& axis) {
+        statistics::detail::Probe<> probe;
+
+        tridimensional::Point<T> x;
+        tridimensional::Point<T> y;
+        if (axis == tridimensional::Vector<T>()) {
+            x = start<T>(xs);
+            y = start<T>(ys);
+        } else {
+            probe.support();
+            x = *support(xs,  axis);
+            y = *support(ys, -axis);
+            if (tridimensional::point::dot(difference(x, y), axis) < 0) { probe.early_out(); return std::nullopt; }
+        }
+        record(x, y);
+
+        Step<T> step = nearest(difference(x, y));
+        for (std::size_t i = 0; i < iterations; i++) {
+            tridimensional::Vector<T> v = narrow<T>(-step.closest);
+            if (v == tridimensional::Vector<T>()) { return step; }
+            axis = v;
+
+            probe.iteration();
+            probe.support();
+            x = *support(xs,  v);
+            y = *support(ys, -v);
+            record(x, y);
+
+            tridimensional::Point<T> a = difference(x, y);
+            if (tridimensional::point::dot(a, v) < 0) { probe.early_out(); return std::nullopt; }
+            if (std::visit(has_vertex<T>{a}, step.simplex)) { return step; }
+
+            step = std::visit(evolve<T>{a}, step.simplex);
+            probe.transition(step.simplex.index());
+            if (step.contains) { return step; }
+        }
+        return step;
+    }
+
+    template <typename T, typename X, typename Y, typename F>
+    inline std::optional<Step<T>>
+    gjk(const X& xs, const Y& ys, F&& record) {
+        tridimensional::Vector<T> axis;
+        return gjk<T>(xs, ys, record, axis);
+    }
+} // namespace detail
+
+    // Support points along several directions at once, each written at the
+    // index of its direction, for as many directions as out holds. Point
+    // arrays are read once per group of sixteen directions instead of once
+    // per direction; other shapes answer one support query per direction.
+    // Returns false, writing nothing, for an empty shape.
+    template <SupportMappable S, typename T>
+    inline bool
+    support_many(const S& s, std::span<const tridimensional::Vector<T>> vs, std::span<tridimensional::Point<T>> out) {
+        if (detail::empty(s)) {
+            return false;
+        } else {
+            std::size_t n = std::min(vs.size(), out.size());
+            for (std::size_t j = 0; j < n; j++) { out[j] = *support(s, vs[j]); }
+            return true;
+        }
+    }
+
+    template <typename T>
+    inline bool
+    support_many(
+              std::span<const tridimensional::Point<T>> ps
+            , std::span<const tridimensional::Vector<T>> vs
+            , std::span<tridimensional::Point<T>> out
+            )
+    {
+        constexpr std::size_t group = tridimensional::cloud::detail::group;
+
+        if (ps.empty()) {
+            return false;
+        } else {
+            std::size_t n = std::min(vs.size(), out.size());
+            for (std::size_t first = 0; first < n; first += group) {
+                std::size_t k = std::min(group, n - first);
+
+                std::array<tridimensional::point::int128, group> maxima;
+                maxima.fill(std::numeric_limits<tridimensional::point::int128>::min());
+                for (const tridimensional::Point<T>& p : ps) {
+                    for (std::size_t j = 0; j < k; j++) {
+                        tridimensional::point::int128 current = tridimensional::point::dot(p, vs[first + j]);
+                        if (current > maxima[j]) { out[first + j] = p; maxima[j] = current; }
+                    }
+                }
+            }
+            return true;
+        }
+    }
+
+    template <typename T, typename A>
+    inline bool
+    support_many(
+              const std::vector<tridimensional::Point<T>, A>& ps
+            , std::span<const tridimensional::Vector<T>> vs
+            , std::span<tridimensional::Point<T>> out
+            )
+    {
+        return support_many(std::span<const tridimensional::Point<T>>(ps), vs, out);
+    }
+
+    template <typename T>
+    inline bool
+    support_many(
+              const tridimensional::PointCloudView<T>& ps
+            , std::span<const tridimensional::Vector<T>> vs
+            , std::span<tridimensional::Point<T>> out
+            )
+    {
+        constexpr std::size_t group = tridimensional::cloud::detail::group;
+
+        if (ps.empty()) {
+            return false;
+        } else {
+            std::size_t n = std::min(vs.size(), out.size());
+            for (std::size_t first = 0; first < n; first += group) {
+                std::size_t k = std::min(group, n - first);
+
+                std::array<std::size_t, group> indices;
+                tridimensional::cloud::extremes(ps, vs.subspan(first, k), std::span<std::size_t>(indices.data(), k));
+                for (std::size_t j = 0; j < k; j++) { out[first + j] = ps[indices[j]]; }
+            }
+            return true;
+        }
+    }
+
+    template <typename T>
+    inline bool
+    support_many(
+              const tridimensional::PointCloud<T>& ps
+            , std::span<const tridimensional::Vector<T>> vs
+            , std::span<tridimensional::Point<T>> out
+            )
+    {
+        return support_many(tridimensional::PointCloudView<T>(ps), vs, out);
+    }
+
+    // Reports a pair as disjoint only once a direction is found along which
+    // the Minkowski difference provably stays behind the origin; pairs that
+    // touch, or come within rounding distance of touching, are reported as
+    // intersecting.
+    template <SupportMappable X, SupportMappable Y>
+        requires std::same_as<typename X::value_type, typename Y::value_type>
+    inline std::optional<bool>
+    detect(const X& xs, const Y& ys) {
+        using T = detail::unit_of<X>;
+
+        if (detail::empty(xs) or detail::empty(ys)) {
+            return std::nullopt;
+        } else {
+            auto ignore = [](const tridimensional::Point<T>&, const tridimensional::Point<T>&) {};
+            return detail::gjk<T>(xs, ys, ignore).has_value();
+        }
+    }
+
+    // Runs detect over every candidate pair, writing each answer at the
+    // index of its pair. Returns false, leaving results untouched, unless
+    // it is exactly as long as pairs. Pairs are handed to the pool in fixed
+    // size batches, and nothing is allocated per pair.
+    template <SupportMappable X, SupportMappable Y>
+        requires std::same_as<typename X::value_type, typename Y::value_type>
+    inline bool
+    detect_batch(
+              std::span<const std::pair<const X*, const Y*>> pairs
+            , std::span<std::optional<bool>> results
+            , parallel::Pool& pool = parallel::pool()
+            )
+    {
+        constexpr std::size_t batch = 64;
+
+        if (pairs.size() != results.size()) { return false; }
+
+        std::size_t n = pairs.size();
+        pool.run((n + batch - 1) / batch, [&pairs, &results, n](std::size_t k) {
+            for (std::size_t i = k * batch; i < std::min(n, (k + 1) * batch); i++) {
+                results[i] = detect(*pairs[i].first, *pairs[i].second);
+            }
+        });
+        return true;
+    }
 } // namespace collision
 } // namespace paulista
 
@@ -0,0 +1,116 @@
+#ifndef PAULISTA_DISTANCE_HPP__
+#define PAULISTA_DISTANCE_HPP__
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <optional>
+#include <variant>
+
+#include "paulista-collision.hpp"
+#include "paulista-point.hpp"
+#include "paulista-simplex.hpp"
+
+namespace paulista {
+namespace collision {
+    // Closest points x and y of two disjoint shapes, at the given distance
+    // from each other.
+    struct Separation {
+        double                  distance;
+        std::array<double, 3>   x;
+        std::array<double, 3>   y;
+    };
+
+namespace detail {
+    // Runs distance from the support points along a non-zero axis, or from
+    // the start points otherwise, leaving in axis the last direction
+    // searched along, the separating one for disjoint shapes.
+    template <typename T, typename X, typename Y>
+    inline std::optional<Separation>
+    separation(const X& xs, const Y& ys, tridimensional::Vector<T>& axis) {
+        std::array<Vertex<T>, iterations + 1> records;
+        std::size_t recorded = 0;
+        auto record = [&records, &recorded](const tridimensional::Point<T>& x, const tridimensional::Point<T>& y) {
+            if (recorded < records.size()) { records[recorded++] = {difference(x, y), x, y}; }
+        };
+
+        statistics::detail::Probe<> probe;
+
+        if (axis == tridimensional::Vector<T>()) {
+            record(start<T>(xs), start<T>(ys));
+        } else {
+            probe.support();
+            record(*support(xs, axis), *support(ys, -axis));
+        }
+        Step<T> step = nearest(records[0].a);
+        bool separated = false;
+        for (std::size_t i = 0; i < iterations; i++) {
+            tridimensional::Vector<T> v = narrow<T>(-step.closest);
+            if (v == tridimensional::Vector<T>()) { return std::nullopt; }
+            axis = v;
+
+            probe.iteration();
+            probe.support();
+            tridimensional::Point<T> x = *support(xs,  v);
+            tridimensional::Point<T> y = *support(ys, -v);
+            tridimensional::Point<T> a = difference(x, y);
+            separated = separated or (tridimensional::point::dot(a, v) < 0);
+            if (std::visit(has_vertex<T>{a}, step.simplex)) { break; }
+
+            double squared = step.closest.dot(step.closest);
+            if ((squared - step.closest.dot(real(a))) <= (tolerance * squared)) { break; }
+
+            record(x, y);
+            step = std::visit(evolve<T>{a}, step.simplex);
+            probe.transition(step.simplex.index());
+            if (step.contains) { return std::nullopt; }
+        }
+        if (not separated) { return std::nullopt; }
+
+        Corners<T> cs = std::visit(corners<T>{}, step.simplex);
+        std::array<Vertex<T>, 3> vs;
+        for (std::size_t i = 0; i < cs.count; i++) {
+            for (std::size_t j = 0; j < recorded; j++) {
+                if (records[j].a == cs.points[i]) { vs[i] = records[j]; break; }
+            }
+        }
+
+        std::array<Real, 3> as = {real(vs[0].a), real(vs[1].a), real(vs[2].a)};
+        std::array<double, 3> w = weights(as, cs.count, Real{0.0, 0.0, 0.0});
+
+        Real x = {0.0, 0.0, 0.0};
+        Real y = {0.0, 0.0, 0.0};
+        for (std::size_t i = 0; i < cs.count; i++) {
+            x = x + (real(vs[i].x) * w[i]);
+            y = y + (real(vs[i].y) * w[i]);
+        }
+        return Separation{
+              std::sqrt(step.closest.dot(step.closest))
+            , {x.x, x.y, x.z}
+            , {y.x, y.y, y.z}
+            };
+    }
+} // namespace detail
+
+    // Distance and closest points of two disjoint shapes, running GJK until
+    // the support point along the current search direction no longer moves
+    // the closest feature of the simplex towards the origin. Returns nothing
+    // for empty or intersecting shapes, and, as detect reports them
+    // intersecting, for shapes no separating direction was proven for.
+    template <SupportMappable X, SupportMappable Y>
+        requires std::same_as<typename X::value_type, typename Y::value_type>
+    inline std::optional<Separation>
+    distance(const X& xs, const Y& ys) {
+        using T = detail::unit_of<X>;
+
+        if (detail::empty(xs) or detail::empty(ys)) {
+            return std::nullopt;
+        } else {
+            tridimensional::Vector<T> axis;
+            return detail::separation<T>(xs, ys, axis);
+        }
+    }
+} // namespace collision
+} // namespace paulista
+
+#endif // PAULISTA_DISTANCE_HPP__
@@ -0,0 +1,218 @@
+#ifndef PAULISTA_GRID_HPP__
+#define PAULISTA_GRID_HPP__
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "paulista-box.hpp"
+#include "paulista-bvh.hpp"
+#include "paulista-point.hpp"
+
+namespace paulista {
+namespace collision {
+    // Uniform grid hashing every box into each cell it overlaps, kept in an
+    // open addressing table with the members of each cell stored
+    // contiguously. A box covering more than `oversize` cells goes to a
+    // separate list instead, which every query tests directly, so a single
+    // large box neither floods the table nor widens the cells a query
+    // visits. A pair sharing several cells is reported only from the cell
+    // holding the larger of their lower corners, which lies in both boxes.
+    template <typename T>
+    class Grid {
+        static_assert(dimension::is_dimension<T>::value);
+        public:
+            static constexpr std::int64_t oversize = 64;
+
+            explicit Grid(T cell)
+                : cell_(std::max<std::int64_t>(1, static_cast<std::int32_t>(cell)))
+            {}
+
+            bool            empty() const   { return boxes_.empty(); }
+            std::size_t     size() const    { return boxes_.size(); }
+
+            // Replaces the contents of the grid with the given boxes.
+            void
+            insert(const std::vector<tridimensional::Box<T>>& boxes) {
+                boxes_ = boxes;
+                corners_.resize(boxes_.size());
+                large_.clear();
+
+                std::size_t entries = 0;
+                for (std::size_t i = 0; i < boxes_.size(); i++) {
+                    corners_[i] = cell(boxes_[i].lower());
+                    std::int64_t n = cells(corners_[i], cell(boxes_[i].upper()));
+                    if (n > oversize) {
+                        large_.push_back(static_cast<std::uint32_t>(i));
+                    } else {
+                        entries += static_cast<std::size_t>(n);
+                    }
+                }
+
+                std::size_t capacity = std::bit_ceil(std::max<std::size_t>(16, 2 * entries));
+                slots_.assign(capacity, Slot{});
+                members_.resize(entries);
+
+                std::vector<std::size_t> homes;
+                homes.reserve(entries);
+                each(
+                    [this, &homes](std::size_t, const Cell& c) {
+                        std::size_t s = probe(c);
+                        slots_[s].cell = c;
+                        slots_[s].count++;
+                        homes.push_back(s);
+                    });
+
+                std::uint32_t offset = 0;
+                for (Slot& s : slots_) {
+                    s.first = offset;
+                    offset += s.count;
+                    s.count = 0;
+                }
+                std::size_t k = 0;
+                each(
+                    [this, &homes, &k](std::size_t i, const Cell&) {
+                        Slot& s = slots_[homes[k++]];
+                        members_[s.first + s.count++] = static_cast<std::uint32_t>(i);
+                    });
+            }
+
+            // Calls f once with the index of every box overlapping b. A query
+            // box covering more than `oversize` cells scans the boxes
+            // directly rather than walking its cells.
+            template <typename F>
+            void
+            query(const tridimensional::Box<T>& b, F&& f) const {
+                if (boxes_.empty()) { return; }
+
+                Cell lower = cell(b.lower());
+                Cell upper = cell(b.upper());
+                if (cells(lower, upper) > oversize) {
+                    for (std::size_t i = 0; i < boxes_.size(); i++) {
+                        if (boxes_[i].overlaps(b)) { f(i); }
+                    }
+                    return;
+                }
+
+                for (std::uint32_t i : large_) {
+                    if (boxes_[i].overlaps(b)) { f(i); }
+                }
+                for (std::int64_t x = lower[0]; x <= upper[0]; x++) {
+                    for (std::int64_t y = lower[1]; y <= upper[1]; y++) {
+                        for (std::int64_t z = lower[2]; z <= upper[2]; z++) {
+                            const Slot& s = slots_[probe({x, y, z})];
+                            for (std::uint32_t i = s.first; i < s.first + s.count; i++) {
+                                std::uint32_t m = members_[i];
+                                const Cell& corner = corners_[m];
+                                if (    x == std::max(corner[0], lower[0])
+                                    and y == std::max(corner[1], lower[1])
+                                    and z == std::max(corner[2], lower[2])
+                                    and boxes_[m].overlaps(b)
+                                   )
+                                {
+                                    f(m);
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+
+            // Every pair of boxes that overlap, as (lower, higher) indices,
+            // replacing the contents of ps.
+            void
+            pairs(std::vector<Pair>& ps) const {
+                ps.clear();
+                for (std::size_t i = 0; i < boxes_.size(); i++) {
+                    query(boxes_[i], [&ps, i](std::size_t j) {
+                        if (i < j) { ps.push_back({i, j}); }
+                    });
+                }
+            }
+
+            std::vector<Pair>
+            pairs() const {
+                std::vector<Pair> ps;
+                pairs(ps);
+                return ps;
+            }
+        private:
+            using Cell = std::array<std::int64_t, 3>;
+
+            struct Slot {
+                Cell            cell    = {0, 0, 0};
+                std::uint32_t   first   = 0;
+                std::uint32_t   count   = 0;
+            };
+
+            Cell
+            cell(const tridimensional::Point<T>& p) const {
+                auto floor = [this](std::int64_t v) {
+                    return v >= 0 ? v / cell_ : -((cell_ - 1 - v) / cell_);
+                };
+                return {
+                      floor(static_cast<std::int32_t>(p.x()))
+                    , floor(static_cast<std::int32_t>(p.y()))
+                    , floor(static_cast<std::int32_t>(p.z()))
+                };
+            }
+
+            // Number of cells from lower to upper, saturating past oversize.
+            static std::int64_t
+            cells(const Cell& lower, const Cell& upper) {
+                std::int64_t n = 1;
+                for (std::size_t axis = 0; axis < 3; axis++) {
+                    n *= std::min(upper[axis] - lower[axis] + 1, oversize + 1);
+                    if (n > oversize) { return oversize + 1; }
+                }
+                return n;
+            }
+
+            // Calls f(i, c) for every cell c covered by every box i that is
+            // not in the oversize list, in the same order on every call.
+            template <typename F>
+            void
+            each(F&& f) const {
+                std::size_t next = 0;
+                for (std::size_t i = 0; i < boxes_.size(); i++) {
+                    if (next < large_.size() and large_[next] == i) { next++; continue; }
+
+                    const Cell& lower = corners_[i];
+                    Cell upper = cell(boxes_[i].upper());
+                    for (std::int64_t x = lower[0]; x <= upper[0]; x++) {
+                        for (std::int64_t y = lower[1]; y <= upper[1]; y++) {
+                            for (std::int64_t z = lower[2]; z <= upper[2]; z++) {
+                                f(i, Cell{x, y, z});
+                            }
+                        }
+                    }
+                }
+            }
+
+            // Slot holding the cell, or the empty slot where it would go.
+            std::size_t
+            probe(const Cell& c) const {
+                std::uint64_t h = (static_cast<std::uint64_t>(c[0]) * 0x9e3779b97f4a7c15ull)
+                                ^ (static_cast<std::uint64_t>(c[1]) * 0xc2b2ae3d27d4eb4full)
+                                ^ (static_cast<std::uint64_t>(c[2]) * 0x165667b19e3779f9ull)
+                                ;
+                std::size_t mask = slots_.size() - 1;
+                for (std::size_t s = (h ^ (h >> 29)) & mask;; s = (s + 1) & mask) {
+                    if (slots_[s].count == 0 or slots_[s].cell == c) { return s; }
+                }
+            }
+
+            std::int64_t                        cell_;
+            std::vector<tridimensional::Box<T>> boxes_;
+            std::vector<Cell>                   corners_;
+            std::vector<std::uint32_t>          large_;
+            std::vector<Slot>                   slots_;
+            std::vector<std::uint32_t>          members_;
+    };
+} // namespace collision
+} // namespace paulista
+
+#endif // PAULISTA_GRID_HPP__
@@ -0,0 +1,449 @@
+#ifndef PAULISTA_HULL_HPP__
+#define PAULISTA_HULL_HPP__
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory_resource>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "paulista-collision.hpp"
+#include "paulista-parallel.hpp"
+#include "paulista-point.hpp"
+#include "paulista-polytope.hpp"
+
+namespace paulista {
+namespace collision {
+    // Convex hull as a triangulated surface over its extreme vertices, with
+    // faces wound counterclockwise when seen from outside. Flat inputs give
+    // a fan over their convex polygon, and collinear or coincident inputs
+    // give a single degenerate face, so the vertex graph stays connected.
+    template <typename T>
+    struct Hull {
+        std::vector<tridimensional::Point<T>>   vertices;
+        std::vector<Face>                       faces;
+    };
+
+namespace detail {
+    constexpr std::size_t none = std::numeric_limits<std::size_t>::max();
+
+    struct Facet {
+        std::array<std::size_t, 3>  v;
+        std::array<std::size_t, 3>  n;
+        Wide                        normal;
+        int128                      offset;
+        std::size_t                 first;
+        std::size_t                 last;
+        std::size_t                 stamp;
+        bool                        visible;
+        bool                        alive;
+
+        int128
+        height(const Wide& p) const {
+            return normal.dot(p) - offset;
+        }
+    };
+
+    struct Horizon {
+        std::size_t u;
+        std::size_t v;
+        std::size_t facet;
+    };
+
+    // Facet through a, b and c with no outside points. Its outside points
+    // form a list from first to last threaded through the next array of
+    // hull, so redistributing them allocates nothing.
+    template <typename T>
+    inline Facet
+    facet(
+              std::span<const tridimensional::Point<T>> ps
+            , std::size_t a
+            , std::size_t b
+            , std::size_t c
+            )
+    {
+        Wide u      = widen(ps[a]);
+        Wide normal = (widen(ps[b]) - u).cross(widen(ps[c]) - u);
+        return {{a, b, c}, {none, none, none}, normal, normal.dot(u), none, none, 0, false, true};
+    }
+
+    // Whether p comes after q comparing x, then y, then z. Among points
+    // maximizing a linear function, which span a face of their hull, the
+    // last one in this order is a vertex of that face, so breaking ties
+    // with it keeps every point picked extreme.
+    template <typename T>
+    inline bool
+    after(const tridimensional::Point<T>& p, const tridimensional::Point<T>& q) {
+        auto key = [](const tridimensional::Point<T>& r) {
+            return std::array<std::int32_t, 3>{
+                  static_cast<std::int32_t>(r.x())
+                , static_cast<std::int32_t>(r.y())
+                , static_cast<std::int32_t>(r.z())
+                };
+        };
+        return key(p) > key(q);
+    }
+
+    // Index of the first point maximizing key, ties going to the one last
+    // in the order of after, searched in parallel chunks. Key is the
+    // height over a plane, its magnitude, or the distance to a line, whose
+    // maximizing points lie on a segment parallel to it; in every case the
+    // point found is extreme.
+    template <typename T, typename F>
+    inline std::size_t
+    argmax(
+              std::span<const tridimensional::Point<T>> ps
+            , std::size_t threads
+            , parallel::Pool& pool
+            , std::pmr::memory_resource* scratch
+            , F key
+            )
+    {
+        std::size_t k = parallel::partitions(ps.size(), threads);
+        std::pmr::vector<std::pair<int128, std::size_t>> best(k, {std::numeric_limits<int128>::min(), none}, scratch);
+
+        auto better = [&ps](const std::pair<int128, std::size_t>& lhs, const std::pair<int128, std::size_t>& rhs) {
+            return  (rhs.second == none)
+                or  (lhs.first > rhs.first)
+                or  (lhs.first == rhs.first and after(ps[lhs.second], ps[rhs.second]))
+                ;
+        };
+
+        parallel::chunks(pool, ps.size(), k, [&best, &key, &better](std::size_t i, std::size_t begin, std::size_t end) {
+            for (std::size_t j = begin; j < end; j++) {
+                std::pair<int128, std::size_t> candidate = {key(j), j};
+                if (better(candidate, best[i])) { best[i] = candidate; }
+            }
+        });
+
+        std::size_t choice = 0;
+        for (std::size_t i = 1; i < k; i++) {
+            if (best[i].second != none and better(best[i], best[choice])) { choice = i; }
+        }
+        return best[choice].second;
+    }
+
+    // Writes to target[j] the position in created of the first facet that
+    // point members[j] lies strictly above, or none, in parallel chunks.
+    template <typename T>
+    inline void
+    classify(
+              std::span<const tridimensional::Point<T>> ps
+            , std::span<const std::size_t> members
+            , std::span<const std::size_t> created
+            , std::span<const Facet> facets
+            , std::span<std::size_t> target
+            , std::size_t threads
+            , parallel::Pool& pool
+            )
+    {
+        std::size_t k = parallel::partitions(members.size(), threads);
+        parallel::chunks(pool, members.size(), k, [&](std::size_t, std::size_t begin, std::size_t end) {
+            for (std::size_t j = begin; j < end; j++) {
+                Wide p = widen(ps[members[j]]);
+                target[j] = none;
+                for (std::size_t g = 0; g < created.size(); g++) {
+                    if (facets[created[g]].height(p) > 0) { target[j] = g; break; }
+                }
+            }
+        });
+    }
+
+    template <typename T>
+    inline Hull<T>
+    planar(std::span<const tridimensional::Point<T>> ps, const Wide& normal, std::pmr::memory_resource* scratch) {
+        // Projects away the dominant axis of the normal, which keeps the
+        // polygon convex, and runs a monotone chain on the exact 2D cross.
+        auto magnitude = [](int128 c) { return c < 0 ? -c : c; };
+        std::size_t axis = 0;
+        if (magnitude(normal.y) > magnitude(normal.x)) { axis = 1; }
+        if (magnitude(normal.z) > magnitude(axis == 0 ? normal.x : normal.y)) { axis = 2; }
+
+        auto project = [axis](const tridimensional::Point<T>& p) {
+            Wide w = widen(p);
+            switch (axis) {
+                case 0:     return std::pair<int128, int128>{w.y, w.z};
+                case 1:     return std::pair<int128, int128>{w.z, w.x};
+                default:    return std::pair<int128, int128>{w.x, w.y};
+            }
+        };
+
+        std::pmr::vector<std::size_t> order(ps.size(), scratch);
+        for (std::size_t i = 0; i < ps.size(); i++) { order[i] = i; }
+        std::sort(order.begin(), order.end(), [&ps, &project](std::size_t i, std::size_t j) {
+            return project(ps[i]) < project(ps[j]);
+        });
+
+        auto turn = [&ps, &project](std::size_t o, std::size_t a, std::size_t b) {
+            auto [ox, oy] = project(ps[o]);
+            auto [ax, ay] = project(ps[a]);
+            auto [bx, by] = project(ps[b]);
+            return ((ax - ox) * (by - oy)) - ((ay - oy) * (bx - ox));
+        };
+
+        std::pmr::vector<std::size_t> chain(scratch);
+        for (std::size_t pass = 0; pass < 2; pass++) {
+            std::size_t base = chain.size();
+            for (std::size_t i : order) {
+                while (chain.size() >= base + 2 and turn(chain[chain.size() - 2], chain.back(), i) <= 0) {
+                    chain.pop_back();
+                }
+                chain.push_back(i);
+            }
+            chain.pop_back();
+            std::reverse(order.begin(), order.end());
+        }
+
+        Hull<T> h;
+        for (std::size_t i : chain) { h.vertices.push_back(ps[i]); }
+        for (std::size_t i = 1; i + 1 < h.vertices.size(); i++) {
+            h.faces.push_back({0, i, i + 1});
+        }
+        return h;
+    }
+} // namespace detail
+
+    // Integer exact QuickHull. Predicates are evaluated on 128-bit plane
+    // equations, so coordinates are expected within +-2^29 as for detect().
+    // With more than one thread, the passes that seed the initial
+    // tetrahedron, and every redistribution of outside points to new
+    // facets large enough to split, run as up to `threads` tasks of pool;
+    // choosing eyes and stitching facets stays serial. The result does not
+    // depend on the thread count. Working buffers are taken from scratch
+    // by the calling thread only, so that a per-thread arena such as
+    // memory::local() may back them. Outside sets are lists threaded
+    // through one array and dead facets are reused, so every buffer is
+    // sized once or grows to a high-water mark and none is ever freed,
+    // which keeps a monotonic scratch close to the live working set.
+    template <typename T>
+    inline Hull<T>
+    hull(
+              std::span<const tridimensional::Point<T>> ps
+            , std::size_t threads = 1
+            , std::pmr::memory_resource* scratch = std::pmr::get_default_resource()
+            , parallel::Pool& pool = parallel::pool()
+            )
+    {
+        using detail::Facet;
+        using detail::Horizon;
+        using detail::Wide;
+        using detail::int128;
+        using detail::none;
+        using detail::widen;
+
+        if (ps.empty()) { return {}; }
+
+        // Lowest and highest point along each axis, ties broken on the
+        // other two axes in turn, so that every seed is a vertex.
+        auto order = [&ps](std::size_t i, std::size_t axis) {
+            std::array<std::int32_t, 3> c = {
+                  static_cast<std::int32_t>(ps[i].x())
+                , static_cast<std::int32_t>(ps[i].y())
+                , static_cast<std::int32_t>(ps[i].z())
+                };
+            return std::array<std::int32_t, 3>{c[axis], c[(axis + 1) % 3], c[(axis + 2) % 3]};
+        };
+        std::array<std::size_t, 6> extremes = {0, 0, 0, 0, 0, 0};
+        for (std::size_t i = 0; i < ps.size(); i++) {
+            for (std::size_t axis = 0; axis < 3; axis++) {
+                if (order(i, axis) < order(extremes[2 * axis], axis))       { extremes[2 * axis] = i; }
+                if (order(i, axis) > order(extremes[2 * axis + 1], axis))   { extremes[2 * axis + 1] = i; }
+            }
+        }
+
+        std::size_t a = extremes[0];
+        std::size_t b = extremes[0];
+        int128 spread = 0;
+        for (std::size_t i : extremes) {
+            for (std::size_t j : extremes) {
+                Wide d = widen(ps[j]) - widen(ps[i]);
+                if (d.dot(d) > spread) { spread = d.dot(d); a = i; b = j; }
+            }
+        }
+        if (spread == 0) { return {{ps[a]}, {{0, 0, 0}}}; }
+
+        Wide ab = widen(ps[b]) - widen(ps[a]);
+        std::size_t c = detail::argmax(ps, threads, pool, scratch, [&ps, &ab, a](std::size_t i) {
+            Wide n = ab.cross(widen(ps[i]) - widen(ps[a]));
+            return n.dot(n);
+        });
+        Wide normal = ab.cross(widen(ps[c]) - widen(ps[a]));
+        if (normal.zero()) { return {{ps[a], ps[b]}, {{0, 1, 1}}}; }
+
+        int128 offset = normal.dot(widen(ps[a]));
+        std::size_t d = detail::argmax(ps, threads, pool, scratch, [&ps, &normal, offset](std::size_t i) {
+            int128 h = normal.dot(widen(ps[i])) - offset;
+            return h < 0 ? -h : h;
+        });
+        if (normal.dot(widen(ps[d])) == offset) { return detail::planar(ps, normal, scratch); }
+
+        if (normal.dot(widen(ps[d])) > offset) { std::swap(b, c); }
+
+        std::pmr::vector<Facet> facets(scratch);
+        facets.push_back(detail::facet(ps, a, b, c));
+        facets.push_back(detail::facet(ps, a, d, b));
+        facets.push_back(detail::facet(ps, b, d, c));
+        facets.push_back(detail::facet(ps, c, d, a));
+        for (Facet& f : facets) {
+            for (std::size_t i = 0; i < 3; i++) {
+                std::size_t u = f.v[i];
+                std::size_t v = f.v[(i + 1) % 3];
+                for (std::size_t g = 0; g < facets.size(); g++) {
+                    for (std::size_t j = 0; j < 3; j++) {
+                        if (facets[g].v[j] == v and facets[g].v[(j + 1) % 3] == u) { f.n[i] = g; }
+                    }
+                }
+            }
+        }
+
+        std::pmr::vector<std::size_t>   next(ps.size(), none, scratch);
+        std::pmr::vector<std::size_t>   members(ps.size(), scratch);
+        std::pmr::vector<std::size_t>   target(ps.size(), scratch);
+        std::pmr::vector<std::size_t>   created(scratch);
+        std::pmr::vector<std::size_t>   pending(scratch);
+
+        // Appends every point in members to the outside list of the first
+        // created facet it lies above, keeping their order, and queues the
+        // facets that received any.
+        auto distribute = [&]() {
+            detail::classify(ps, std::span<const std::size_t>(members), created, facets, std::span(target).first(members.size()), threads, pool);
+            for (std::size_t j = 0; j < members.size(); j++) {
+                if (target[j] == none) { continue; }
+
+                Facet& f = facets[created[target[j]]];
+                if (f.first == none) { f.first = members[j]; } else { next[f.last] = members[j]; }
+                f.last = members[j];
+                next[members[j]] = none;
+            }
+            for (std::size_t f : created) {
+                if (facets[f].first != none) { pending.push_back(f); }
+            }
+        };
+
+        for (std::size_t i = 0; i < ps.size(); i++) { members[i] = i; }
+        created = {0, 1, 2, 3};
+        distribute();
+
+        std::size_t                                             stamp = 0;
+        std::pmr::vector<std::size_t>                           dead(scratch);
+        std::pmr::vector<std::size_t>                           visible(scratch);
+        std::pmr::vector<Horizon>                               horizon(scratch);
+        std::pmr::vector<std::pair<std::size_t, std::size_t>>   starts(scratch);
+        std::pmr::vector<std::pair<std::size_t, std::size_t>>   ends(scratch);
+
+        // A queued facet may have died, or died and been reused, since it
+        // was queued; either way the loop only acts on what it finds.
+        while (not pending.empty()) {
+            std::size_t current = pending.back();
+            pending.pop_back();
+
+            while (facets[current].alive and facets[current].first != none) {
+                std::size_t eye = facets[current].first;
+                int128      top = facets[current].height(widen(ps[eye]));
+                for (std::size_t i = eye; i != none; i = next[i]) {
+                    int128 h = facets[current].height(widen(ps[i]));
+                    if (h > top or (h == top and detail::after(ps[i], ps[eye]))) { top = h; eye = i; }
+                }
+                Wide e = widen(ps[eye]);
+
+                stamp++;
+                visible = {current};
+                horizon.clear();
+                facets[current].stamp   = stamp;
+                facets[current].visible = true;
+                for (std::size_t i = 0; i < visible.size(); i++) {
+                    std::size_t f = visible[i];
+                    for (std::size_t j = 0; j < 3; j++) {
+                        std::size_t g = facets[f].n[j];
+                        if (facets[g].stamp != stamp) {
+                            facets[g].stamp     = stamp;
+                            facets[g].visible   = facets[g].height(e) > 0;
+                            if (facets[g].visible) { visible.push_back(g); }
+                        }
+                        if (not facets[g].visible) {
+                            horizon.push_back({facets[f].v[j], facets[f].v[(j + 1) % 3], g});
+                        }
+                    }
+                }
+
+                created.clear();
+                starts.clear();
+                ends.clear();
+                for (const Horizon& edge : horizon) {
+                    std::size_t f = facets.size();
+                    if (dead.empty()) {
+                        facets.push_back(detail::facet(ps, edge.u, edge.v, eye));
+                    } else {
+                        f = dead.back();
+                        dead.pop_back();
+                        facets[f] = detail::facet(ps, edge.u, edge.v, eye);
+                    }
+                    facets[f].n[0] = edge.facet;
+                    for (std::size_t j = 0; j < 3; j++) {
+                        Facet& g = facets[edge.facet];
+                        if (g.v[j] == edge.v and g.v[(j + 1) % 3] == edge.u) { g.n[j] = f; }
+                    }
+                    created.push_back(f);
+                    starts.push_back({edge.u, f});
+                    ends.push_back({edge.v, f});
+                }
+                std::sort(starts.begin(), starts.end());
+                std::sort(ends.begin(), ends.end());
+                for (std::size_t f : created) {
+                    Facet& g = facets[f];
+                    g.n[1] = std::lower_bound(starts.begin(), starts.end(), std::pair{g.v[1], std::size_t{0}})->second;
+                    g.n[2] = std::lower_bound(ends.begin(), ends.end(), std::pair{g.v[0], std::size_t{0}})->second;
+                }
+
+                members.clear();
+                for (std::size_t f : visible) {
+                    for (std::size_t i = facets[f].first; i != none; i = next[i]) {
+                        if (i != eye) { members.push_back(i); }
+                    }
+                }
+                for (std::size_t f : visible) {
+                    facets[f].alive = false;
+                    facets[f].first = none;
+                    dead.push_back(f);
+                }
+                distribute();
+            }
+        }
+
+        Hull<T> h;
+        std::pmr::vector<std::size_t> index(ps.size(), none, scratch);
+        for (const Facet& f : facets) {
+            if (not f.alive) { continue; }
+
+            Face face;
+            for (std::size_t i = 0; i < 3; i++) {
+                if (index[f.v[i]] == none) {
+                    index[f.v[i]] = h.vertices.size();
+                    h.vertices.push_back(ps[f.v[i]]);
+                }
+                face[i] = index[f.v[i]];
+            }
+            h.faces.push_back(face);
+        }
+        return h;
+    }
+
+    template <typename T, typename A>
+    inline Hull<T>
+    hull(
+              const std::vector<tridimensional::Point<T>, A>& ps
+            , std::size_t threads = 1
+            , std::pmr::memory_resource* scratch = std::pmr::get_default_resource()
+            , parallel::Pool& pool = parallel::pool()
+            )
+    {
+        return hull(std::span<const tridimensional::Point<T>>(ps), threads, scratch, pool);
+    }
+} // namespace collision
+} // namespace paulista
+
+#endif // PAULISTA_HULL_HPP__
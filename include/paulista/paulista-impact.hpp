@@ -0,0 +1,154 @@
+#ifndef PAULISTA_IMPACT_HPP__
+#define PAULISTA_IMPACT_HPP__
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <optional>
+
+#include "paulista-collision.hpp"
+#include "paulista-point.hpp"
+
+namespace paulista {
+namespace collision {
+namespace detail {
+    struct Nearest {
+        Real                    closest;
+        std::array<double, 4>   weights;
+    };
+
+    // Point of the hull of up to four points nearest to the origin, taken
+    // as the nearest of the candidates found on every vertex, edge,
+    // triangle and, when it holds the origin, the tetrahedron.
+    inline Nearest
+    nearest(const std::array<Real, 4>& ps, std::size_t count) {
+        Nearest best = {ps[0], {1.0, 0.0, 0.0, 0.0}};
+        auto consider = [&best](const Real& closest, const std::array<double, 4>& weights) {
+            if (closest.dot(closest) < best.closest.dot(best.closest)) { best = {closest, weights}; }
+        };
+
+        for (std::size_t i = 0; i < count; i++) {
+            std::array<double, 4> vs = {};
+            vs[i] = 1.0;
+            consider(ps[i], vs);
+            for (std::size_t j = i + 1; j < count; j++) {
+                std::array<double, 3> w = weights({ps[i], ps[j], ps[j]}, 2, Real{0.0, 0.0, 0.0});
+
+                std::array<double, 4> ws = {};
+                ws[i] = w[0];
+                ws[j] = w[1];
+                consider((ps[i] * w[0]) + (ps[j] * w[1]), ws);
+
+                for (std::size_t k = j + 1; k < count; k++) {
+                    std::array<double, 3> u = weights({ps[i], ps[j], ps[k]}, 3, Real{0.0, 0.0, 0.0});
+                    if (u[0] < 0.0 or u[1] < 0.0 or u[2] < 0.0) { continue; }
+
+                    std::array<double, 4> us = {};
+                    us[i] = u[0];
+                    us[j] = u[1];
+                    us[k] = u[2];
+                    consider((ps[i] * u[0]) + (ps[j] * u[1]) + (ps[k] * u[2]), us);
+                }
+            }
+        }
+
+        if (count == 4) {
+            // Barycentric weights of the origin by ratios of signed volumes.
+            auto volume = [](const Real& a, const Real& b, const Real& c, const Real& d) {
+                Real u = b - a;
+                Real v = c - a;
+                Real w = d - a;
+                return (u.x * ((v.y * w.z) - (v.z * w.y)))
+                     + (u.y * ((v.z * w.x) - (v.x * w.z)))
+                     + (u.z * ((v.x * w.y) - (v.y * w.x)))
+                     ;
+            };
+            const Real o = {0.0, 0.0, 0.0};
+
+            double total = volume(ps[0], ps[1], ps[2], ps[3]);
+            if (total != 0.0) {
+                std::array<double, 4> ws = {
+                      volume(o, ps[1], ps[2], ps[3]) / total
+                    , volume(ps[0], o, ps[2], ps[3]) / total
+                    , volume(ps[0], ps[1], o, ps[3]) / total
+                    , volume(ps[0], ps[1], ps[2], o) / total
+                };
+                if (std::all_of(ws.begin(), ws.end(), [](double w) { return w >= 0.0; })) {
+                    return {o, ws};
+                }
+            }
+        }
+        return best;
+    }
+} // namespace detail
+
+    // Earliest fraction of the motion at which xs, displaced by dx, first
+    // touches ys, displaced by dy, found by casting a ray against their
+    // Minkowski difference. The fraction only ever advances past regions
+    // proven empty by a separating plane, so it errs on the early side.
+    // Returns nothing for empty shapes or when they stay apart.
+    template <SupportMappable X, SupportMappable Y, typename T>
+        requires std::same_as<typename X::value_type, tridimensional::Point<T>>
+            and std::same_as<typename Y::value_type, tridimensional::Point<T>>
+    inline std::optional<double>
+    impact(
+              const X& xs
+            , const tridimensional::Vector<T>& dx
+            , const Y& ys
+            , const tridimensional::Vector<T>& dy
+            )
+    {
+        if (detail::empty(xs) or detail::empty(ys)) { return std::nullopt; }
+
+        // The shapes touch at t once -t * (dx - dy) lies in xs - ys, so the
+        // ray runs from the origin along dy - dx.
+        const detail::Real ray = detail::real(dy - dx);
+
+        double                          lambda  = 0.0;
+        detail::Real                    point   = {0.0, 0.0, 0.0};
+        std::array<detail::Real, 4>     ps      = {};
+        std::size_t                     count   = 0;
+
+        detail::Real v = point - detail::real(detail::difference(detail::start<T>(xs), detail::start<T>(ys)));
+        for (std::size_t i = 0; i < detail::iterations and v.dot(v) > 0.0; i++) {
+            tridimensional::Vector<T> direction = detail::narrow<T>(v);
+            if (direction == tridimensional::Vector<T>()) { break; }
+
+            detail::Real p = detail::real(*support(xs, ys, direction));
+            detail::Real w = point - p;
+            if (v.dot(w) > 0.0) {
+                if (v.dot(ray) >= 0.0) { return std::nullopt; }
+
+                lambda -= v.dot(w) / v.dot(ray);
+                if (lambda > 1.0) { return std::nullopt; }
+                point = ray * lambda;
+            }
+
+            bool seen = false;
+            for (std::size_t j = 0; j < count; j++) {
+                seen = seen or (ps[j].x == p.x and ps[j].y == p.y and ps[j].z == p.z);
+            }
+            if (seen and v.dot(w) <= 0.0) { break; }
+            if (not seen) { ps[count++] = p; }
+
+            std::array<detail::Real, 4> ws;
+            for (std::size_t j = 0; j < count; j++) { ws[j] = point - ps[j]; }
+            detail::Nearest n = detail::nearest(ws, count);
+
+            std::size_t kept = 0;
+            double extent = 0.0;
+            for (std::size_t j = 0; j < count; j++) {
+                extent = std::max(extent, ws[j].dot(ws[j]));
+                if (n.weights[j] > 0.0) { ps[kept++] = ps[j]; }
+            }
+            count = kept;
+            v = n.closest;
+
+            if (v.dot(v) <= (detail::tolerance * extent)) { break; }
+        }
+        return lambda;
+    }
+} // namespace collision
+} // namespace paulista
+
+#endif // PAULISTA_IMPACT_HPP__
@@ -0,0 +1,199 @@
+#ifndef PAULISTA_IMPLICIT_HPP__
+#define PAULISTA_IMPLICIT_HPP__
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <optional>
+
+#include "paulista-collision.hpp"
+#include "paulista-point.hpp"
+
+namespace paulista {
+namespace collision {
+    // Shapes known by their support function alone, answered in constant
+    // time without holding any points. Curved surfaces answer with the
+    // nearest point of the unit grid, so queries on them are exact up to
+    // half a unit per axis.
+    template <typename T>
+    struct Sphere {
+        using value_type = tridimensional::Point<T>;
+
+        tridimensional::Point<T>    center;
+        T                           radius;
+    };
+
+    // Axis aligned box; rotated ones are Transformed views of it.
+    template <typename T>
+    struct Cuboid {
+        using value_type = tridimensional::Point<T>;
+
+        tridimensional::Point<T>    lower;
+        tridimensional::Point<T>    upper;
+    };
+
+    // Points within radius of the segment from a to b.
+    template <typename T>
+    struct Capsule {
+        using value_type = tridimensional::Point<T>;
+
+        tridimensional::Point<T>    a;
+        tridimensional::Point<T>    b;
+        T                           radius;
+    };
+
+    // Solid cylinder of the given radius around the segment from a to b.
+    template <typename T>
+    struct Cylinder {
+        using value_type = tridimensional::Point<T>;
+
+        tridimensional::Point<T>    a;
+        tridimensional::Point<T>    b;
+        T                           radius;
+    };
+
+    // Minkowski sum of two shapes, such as a rounded box from a cuboid and
+    // a sphere centered at the origin. Combinators keep their operands by
+    // value; large shapes are shared through a Transformed view.
+    template <SupportMappable X, SupportMappable Y>
+    struct Sum {
+        using value_type = typename X::value_type;
+
+        X lhs;
+        Y rhs;
+
+        bool empty() const { return detail::empty(lhs) or detail::empty(rhs); }
+    };
+
+    // Convex hull of two shapes.
+    template <SupportMappable X, SupportMappable Y>
+    struct Union {
+        using value_type = typename X::value_type;
+
+        X lhs;
+        Y rhs;
+
+        bool empty() const { return detail::empty(lhs) and detail::empty(rhs); }
+    };
+
+    // Shape scaled about the origin by positive factors along each axis.
+    template <SupportMappable S>
+    struct Scaled {
+        using value_type = typename S::value_type;
+
+        S                       shape;
+        std::array<double, 3>   factors;
+
+        bool empty() const { return detail::empty(shape); }
+    };
+
+namespace detail {
+    // Nearest grid vector to the given length along v.
+    template <typename T>
+    inline tridimensional::Vector<T>
+    along(const Real& v, double length) {
+        double norm = std::sqrt(v.dot(v));
+        if (norm == 0.0) { return tridimensional::Vector<T>(); }
+
+        double scale = length / norm;
+        return tridimensional::Vector<T>(
+                  static_cast<std::int32_t>(std::llround(v.x * scale))
+                , static_cast<std::int32_t>(std::llround(v.y * scale))
+                , static_cast<std::int32_t>(std::llround(v.z * scale))
+                );
+    }
+
+    // Endpoint of a segment farthest along v.
+    template <typename T>
+    inline const tridimensional::Point<T>&
+    farthest(const tridimensional::Point<T>& a, const tridimensional::Point<T>& b, const tridimensional::Vector<T>& v) {
+        return tridimensional::point::dot(b, v) > tridimensional::point::dot(a, v) ? b : a;
+    }
+} // namespace detail
+
+    template <typename T>
+    inline std::optional<tridimensional::Point<T>>
+    support(const Sphere<T>& s, const tridimensional::Vector<T>& v) {
+        return s.center + detail::along<T>(detail::real(v), static_cast<std::int32_t>(s.radius));
+    }
+
+    template <typename T>
+    inline std::optional<tridimensional::Point<T>>
+    support(const Cuboid<T>& c, const tridimensional::Vector<T>& v) {
+        return tridimensional::Point<T>(
+                  v.x() > T() ? c.upper.x() : c.lower.x()
+                , v.y() > T() ? c.upper.y() : c.lower.y()
+                , v.z() > T() ? c.upper.z() : c.lower.z()
+                );
+    }
+
+    template <typename T>
+    inline std::optional<tridimensional::Point<T>>
+    support(const Capsule<T>& c, const tridimensional::Vector<T>& v) {
+        return detail::farthest(c.a, c.b, v) + detail::along<T>(detail::real(v), static_cast<std::int32_t>(c.radius));
+    }
+
+    // The cap farthest along v, offset by the part of v across the axis.
+    template <typename T>
+    inline std::optional<tridimensional::Point<T>>
+    support(const Cylinder<T>& c, const tridimensional::Vector<T>& v) {
+        detail::Real axis   = detail::real(c.b) - detail::real(c.a);
+        detail::Real u      = detail::real(v);
+
+        double length = axis.dot(axis);
+        detail::Real across = length == 0.0 ? u : u - (axis * (u.dot(axis) / length));
+        return detail::farthest(c.a, c.b, v) + detail::along<T>(across, static_cast<std::int32_t>(c.radius));
+    }
+
+    template <typename X, typename Y, typename T>
+    inline std::optional<tridimensional::Point<T>>
+    support(const Sum<X, Y>& s, const tridimensional::Vector<T>& v) {
+        std::optional<tridimensional::Point<T>> x = support(s.lhs, v);
+        std::optional<tridimensional::Point<T>> y = support(s.rhs, v);
+
+        if (not x or not y) {
+            return std::nullopt;
+        } else {
+            return (*x + *y);
+        }
+    }
+
+    template <typename X, typename Y, typename T>
+    inline std::optional<tridimensional::Point<T>>
+    support(const Union<X, Y>& s, const tridimensional::Vector<T>& v) {
+        std::optional<tridimensional::Point<T>> x = support(s.lhs, v);
+        std::optional<tridimensional::Point<T>> y = support(s.rhs, v);
+
+        if (not x or (y and tridimensional::point::dot(*y, v) > tridimensional::point::dot(*x, v))) {
+            return y;
+        } else {
+            return x;
+        }
+    }
+
+    // D·support(S, D·v) for the diagonal scaling D.
+    template <typename S, typename T>
+    inline std::optional<tridimensional::Point<T>>
+    support(const Scaled<S>& s, const tridimensional::Vector<T>& v) {
+        detail::Real u = detail::real(v);
+        std::optional<tridimensional::Point<T>> p = support(s.shape, detail::narrow<T>({
+                  u.x * s.factors[0]
+                , u.y * s.factors[1]
+                , u.z * s.factors[2]
+                }));
+
+        if (not p) {
+            return std::nullopt;
+        } else {
+            detail::Real q = detail::real(*p);
+            return tridimensional::Point<T>(
+                      static_cast<std::int32_t>(std::llround(q.x * s.factors[0]))
+                    , static_cast<std::int32_t>(std::llround(q.y * s.factors[1]))
+                    , static_cast<std::int32_t>(std::llround(q.z * s.factors[2]))
+                    );
+        }
+    }
+} // namespace collision
+} // namespace paulista
+
+#endif // PAULISTA_IMPLICIT_HPP__
@@ -0,0 +1,579 @@
+#ifndef PAULISTA_IMPORT_HPP__
+#define PAULISTA_IMPORT_HPP__
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <charconv>
+#include <cmath>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "paulista-collision.hpp"
+#include "paulista-point.hpp"
+
+namespace paulista {
+namespace io {
+    struct Options {
+        // Target units per unit of the file.
+        double          scale   = 1.0;
+        // Distinct points per emitted shape; only the last one may be
+        // smaller.
+        std::size_t     chunk   = 1 << 16;
+        // Bytes per read from the file.
+        std::size_t     block   = 1 << 20;
+    };
+
+namespace detail {
+    // Reads a file in blocks on a background thread, one block ahead of
+    // the consumer, so parsing a block overlaps with reading the next.
+    class Reader {
+        public:
+            Reader(const std::string& path, std::size_t block)
+                : file_(std::fopen(path.c_str(), "rb"))
+                , buffers_{std::vector<char>(std::max<std::size_t>(1, block)), std::vector<char>(std::max<std::size_t>(1, block))}
+                , sizes_{0, 0}
+                , ready_{false, false}
+                , current_(0)
+                , started_(false)
+                , done_(false)
+                , failed_(false)
+            {
+                if (file_ != nullptr) { loader_ = std::jthread([this](std::stop_token stop) { load(stop); }); }
+            }
+
+            Reader(const Reader&) = delete;
+            Reader& operator=(const Reader&) = delete;
+
+            ~Reader() {
+                if (loader_.joinable()) {
+                    loader_.request_stop();
+                    loader_.join();
+                }
+                if (file_ != nullptr) { std::fclose(file_); }
+            }
+
+            bool
+            good() const {
+                return file_ != nullptr;
+            }
+
+            bool
+            failed() {
+                std::lock_guard<std::mutex> lock(mutex_);
+                return failed_;
+            }
+
+            // Next block of the file, valid until the following call, or an
+            // empty one past its end.
+            std::span<const char>
+            next() {
+                if (file_ == nullptr or done_) { return {}; }
+
+                std::unique_lock<std::mutex> lock(mutex_);
+                if (started_) {
+                    ready_[current_] = false;
+                    current_ ^= 1;
+                    wake_.notify_all();
+                }
+                started_ = true;
+
+                wake_.wait(lock, [this]() { return ready_[current_]; });
+                done_ = sizes_[current_] == 0;
+                return {buffers_[current_].data(), sizes_[current_]};
+            }
+        private:
+            void
+            load(std::stop_token stop) {
+                for (std::size_t i = 0;; i ^= 1) {
+                    {
+                        std::unique_lock<std::mutex> lock(mutex_);
+                        if (not wake_.wait(lock, stop, [this, i]() { return not ready_[i]; })) { return; }
+                    }
+
+                    std::size_t n = std::fread(buffers_[i].data(), 1, buffers_[i].size(), file_);
+                    {
+                        std::lock_guard<std::mutex> lock(mutex_);
+                        sizes_[i]   = n;
+                        ready_[i]   = true;
+                        failed_     = std::ferror(file_) != 0;
+                    }
+                    wake_.notify_all();
+
+                    if (n == 0) { return; }
+                }
+            }
+
+            std::FILE*                      file_;
+            std::array<std::vector<char>, 2> buffers_;
+            std::array<std::size_t, 2>      sizes_;
+            std::array<bool, 2>             ready_;
+            std::size_t                     current_;
+            bool                            started_;
+            bool                            done_;
+            bool                            failed_;
+            std::mutex                      mutex_;
+            std::condition_variable_any     wake_;
+            std::jthread                    loader_;
+    };
+
+    // Byte and line access over the blocks of a Reader.
+    class Cursor {
+        public:
+            Cursor(const std::string& path, std::size_t block) : reader_(path, block), at_(0) {}
+
+            bool good() const   { return reader_.good(); }
+            bool failed()       { return reader_.failed(); }
+
+            bool
+            bytes(char* out, std::size_t n) {
+                while (n > 0) {
+                    if (at_ == block_.size() and not refill()) { return false; }
+
+                    std::size_t k = std::min(n, block_.size() - at_);
+                    std::memcpy(out, block_.data() + at_, k);
+                    out += k;
+                    at_ += k;
+                    n   -= k;
+                }
+                return true;
+            }
+
+            // Next line without its terminator, or nothing past the end.
+            std::optional<std::string_view>
+            line() {
+                carry_.clear();
+                while (true) {
+                    if (at_ == block_.size() and not refill()) {
+                        if (carry_.empty()) { return std::nullopt; }
+                        return trim(carry_);
+                    }
+
+                    const char* begin   = block_.data() + at_;
+                    std::size_t left    = block_.size() - at_;
+                    const char* end     = static_cast<const char*>(std::memchr(begin, '\n', left));
+                    if (end == nullptr) {
+                        carry_.append(begin, left);
+                        at_ = block_.size();
+                    } else {
+                        at_ += (end - begin) + 1;
+                        if (carry_.empty()) { return trim(std::string_view(begin, end - begin)); }
+
+                        carry_.append(begin, end - begin);
+                        return trim(carry_);
+                    }
+                }
+            }
+        private:
+            static std::string_view
+            trim(std::string_view s) {
+                return (not s.empty() and s.back() == '\r') ? s.substr(0, s.size() - 1) : s;
+            }
+
+            bool
+            refill() {
+                block_  = reader_.next();
+                at_     = 0;
+                return not block_.empty();
+            }
+
+            Reader                  reader_;
+            std::span<const char>   block_;
+            std::size_t             at_;
+            std::string             carry_;
+    };
+
+    inline std::string_view
+    token(std::string_view& s) {
+        std::size_t begin = s.find_first_not_of(" \t");
+        if (begin == std::string_view::npos) {
+            s = {};
+            return {};
+        }
+        std::size_t end = std::min(s.size(), s.find_first_of(" \t", begin));
+        std::string_view t = s.substr(begin, end - begin);
+        s.remove_prefix(end);
+        return t;
+    }
+
+    inline bool
+    number(std::string_view& s, double& value) {
+        std::string_view t = token(s);
+        if (not t.empty() and t.front() == '+') { t.remove_prefix(1); }
+
+        auto [end, error] = std::from_chars(t.data(), t.data() + t.size(), value);
+        return (not t.empty()) and (error == std::errc()) and (end == t.data() + t.size());
+    }
+
+    // Quantizes incoming coordinates and hands them out as shapes of
+    // options.chunk distinct points each. Duplicates are removed within a
+    // chunk through an open addressing table that is cleared by bumping a
+    // stamp, so memory stays bounded by the chunk size.
+    template <typename T, typename F>
+    class Quantizer {
+        public:
+            Quantizer(F& emit, const Options& options)
+                : emit_(emit)
+                , scale_(options.scale)
+                , chunk_(std::max<std::size_t>(1, options.chunk))
+                , stamp_(1)
+                , total_(0)
+                , points_(std::bit_ceil(2 * chunk_))
+                , stamps_(points_.size(), 0)
+            {
+                shape_.reserve(chunk_);
+            }
+
+            // Returns false for a coordinate that is not finite or does not
+            // fit the unit once scaled.
+            bool
+            add(double x, double y, double z) {
+                std::array<std::int32_t, 3> c;
+                std::array<double, 3> vs = {x, y, z};
+                for (std::size_t k = 0; k < 3; k++) {
+                    double r = std::nearbyint(vs[k] * scale_);
+                    if (not (r >= std::numeric_limits<std::int32_t>::min() and r <= std::numeric_limits<std::int32_t>::max())) {
+                        return false;
+                    }
+                    c[k] = static_cast<std::int32_t>(r);
+                }
+
+                tridimensional::Point<T> p(c[0], c[1], c[2]);
+                std::size_t s = probe(p);
+                if (stamps_[s] != stamp_) {
+                    stamps_[s]  = stamp_;
+                    points_[s]  = p;
+                    shape_.push_back(p);
+                    if (shape_.size() == chunk_) { flush(); }
+                }
+                return true;
+            }
+
+            void
+            flush() {
+                if (shape_.empty()) { return; }
+
+                total_ += shape_.size();
+                emit_(std::move(shape_));
+                shape_ = collision::Shape<T>();
+                shape_.reserve(chunk_);
+                stamp_++;
+            }
+
+            std::size_t
+            total() const {
+                return total_;
+            }
+        private:
+            std::size_t
+            probe(const tridimensional::Point<T>& p) const {
+                std::uint64_t h = (static_cast<std::uint64_t>(static_cast<std::int32_t>(p.x())) * 0x9e3779b97f4a7c15ull)
+                                ^ (static_cast<std::uint64_t>(static_cast<std::int32_t>(p.y())) * 0xc2b2ae3d27d4eb4full)
+                                ^ (static_cast<std::uint64_t>(static_cast<std::int32_t>(p.z())) * 0x165667b19e3779f9ull)
+                                ;
+                std::size_t mask = points_.size() - 1;
+                for (std::size_t s = (h ^ (h >> 29)) & mask;; s = (s + 1) & mask) {
+                    if (stamps_[s] != stamp_ or points_[s] == p) { return s; }
+                }
+            }
+
+            F&                                      emit_;
+            double                                  scale_;
+            std::size_t                             chunk_;
+            std::uint32_t                           stamp_;
+            std::size_t                             total_;
+            collision::Shape<T>                     shape_;
+            std::vector<tridimensional::Point<T>>   points_;
+            std::vector<std::uint32_t>              stamps_;
+    };
+
+    template <typename U>
+    inline U
+    decode(const char* bytes, bool swap) {
+        using Bits = std::conditional_t<sizeof(U) == 1, std::uint8_t
+                   , std::conditional_t<sizeof(U) == 2, std::uint16_t
+                   , std::conditional_t<sizeof(U) == 4, std::uint32_t, std::uint64_t>>>;
+
+        Bits bits;
+        std::memcpy(&bits, bytes, sizeof(U));
+        if (swap) { bits = std::byteswap(bits); }
+        return std::bit_cast<U>(bits);
+    }
+
+namespace ply {
+    enum class Format { ascii, little, big };
+    enum class Kind { int8, uint8, int16, uint16, int32, uint32, float32, float64 };
+
+    struct Property {
+        std::string             name;
+        Kind                    kind;
+        std::optional<Kind>     count;
+    };
+
+    struct Element {
+        std::string             name;
+        std::uint64_t           count;
+        std::vector<Property>   properties;
+    };
+
+    struct Header {
+        Format                  format;
+        std::vector<Element>    elements;
+    };
+
+    inline std::optional<Kind>
+    kind(std::string_view name) {
+        if (name == "char"   or name == "int8")     { return Kind::int8; }
+        if (name == "uchar"  or name == "uint8")    { return Kind::uint8; }
+        if (name == "short"  or name == "int16")    { return Kind::int16; }
+        if (name == "ushort" or name == "uint16")   { return Kind::uint16; }
+        if (name == "int"    or name == "int32")    { return Kind::int32; }
+        if (name == "uint"   or name == "uint32")   { return Kind::uint32; }
+        if (name == "float"  or name == "float32")  { return Kind::float32; }
+        if (name == "double" or name == "float64")  { return Kind::float64; }
+        return std::nullopt;
+    }
+
+    inline std::size_t
+    size(Kind k) {
+        switch (k) {
+            case Kind::int8:    case Kind::uint8:   return 1;
+            case Kind::int16:   case Kind::uint16:  return 2;
+            case Kind::int32:   case Kind::uint32:  case Kind::float32: return 4;
+            default:                                return 8;
+        }
+    }
+
+    inline std::optional<Header>
+    header(Cursor& in) {
+        std::optional<std::string_view> l = in.line();
+        if (not l or *l != "ply") { return std::nullopt; }
+
+        std::optional<Header> h = std::nullopt;
+        std::optional<Format> format = std::nullopt;
+        std::vector<Element> elements;
+        for (l = in.line(); l; l = in.line()) {
+            std::string_view rest = *l;
+            std::string_view keyword = token(rest);
+
+            if (keyword == "end_header") {
+                if (format) { h = Header{*format, std::move(elements)}; }
+                return h;
+            } else if (keyword == "format") {
+                std::string_view name = token(rest);
+                if (name == "ascii")                    { format = Format::ascii; }
+                if (name == "binary_little_endian")     { format = Format::little; }
+                if (name == "binary_big_endian")        { format = Format::big; }
+            } else if (keyword == "element") {
+                std::string_view name   = token(rest);
+                std::string_view count  = token(rest);
+
+                std::uint64_t n = 0;
+                auto [end, error] = std::from_chars(count.data(), count.data() + count.size(), n);
+                if (error != std::errc() or end != count.data() + count.size()) { return std::nullopt; }
+                elements.push_back({std::string(name), n, {}});
+            } else if (keyword == "property") {
+                if (elements.empty()) { return std::nullopt; }
+
+                std::string_view type = token(rest);
+                Property p;
+                if (type == "list") {
+                    p.count = kind(token(rest));
+                    if (not p.count) { return std::nullopt; }
+                    type = token(rest);
+                }
+                std::optional<Kind> k = kind(type);
+                if (not k) { return std::nullopt; }
+
+                p.kind = *k;
+                p.name = std::string(token(rest));
+                elements.back().properties.push_back(std::move(p));
+            }
+        }
+        return std::nullopt;
+    }
+
+    inline std::optional<double>
+    binary(Cursor& in, Kind k, bool swap) {
+        std::array<char, 8> bytes;
+        if (not in.bytes(bytes.data(), size(k))) { return std::nullopt; }
+
+        switch (k) {
+            case Kind::int8:    return decode<std::int8_t>(bytes.data(), swap);
+            case Kind::uint8:   return decode<std::uint8_t>(bytes.data(), swap);
+            case Kind::int16:   return decode<std::int16_t>(bytes.data(), swap);
+            case Kind::uint16:  return decode<std::uint16_t>(bytes.data(), swap);
+            case Kind::int32:   return decode<std::int32_t>(bytes.data(), swap);
+            case Kind::uint32:  return decode<std::uint32_t>(bytes.data(), swap);
+            case Kind::float32: return decode<float>(bytes.data(), swap);
+            default:            return decode<double>(bytes.data(), swap);
+        }
+    }
+
+    // Reads one entry of an element into values, one per scalar property,
+    // skipping over the items of list properties.
+    inline bool
+    entry(Cursor& in, const Header& h, const Element& e, std::vector<double>& values) {
+        values.clear();
+        if (h.format == Format::ascii) {
+            std::optional<std::string_view> l = in.line();
+            if (not l) { return false; }
+
+            std::string_view rest = *l;
+            for (const Property& p : e.properties) {
+                double value;
+                if (not number(rest, value)) { return false; }
+                if (p.count) {
+                    for (double i = 0; i < value; i++) {
+                        if (token(rest).empty()) { return false; }
+                    }
+                }
+                values.push_back(value);
+            }
+        } else {
+            bool swap = (h.format == Format::big) != (std::endian::native == std::endian::big);
+            for (const Property& p : e.properties) {
+                std::optional<double> value = binary(in, p.count ? *p.count : p.kind, swap);
+                if (not value) { return false; }
+                if (p.count) {
+                    if (*value < 0) { return false; }
+                    for (double i = 0; i < *value; i++) {
+                        if (not binary(in, p.kind, swap)) { return false; }
+                    }
+                }
+                values.push_back(*value);
+            }
+        }
+        return true;
+    }
+} // namespace ply
+} // namespace detail
+
+    // Streams the vertices of a binary STL file, three per triangle, into
+    // shapes of options.chunk distinct points each, handed to emit as
+    // collision::Shape<T>&&. Returns the number of points emitted, or
+    // nothing when the file cannot be read, is truncated, or holds a
+    // coordinate that does not fit T; shapes emitted before an error are
+    // not taken back.
+    template <typename T, typename F>
+    inline std::optional<std::size_t>
+    stl(const std::string& path, F&& emit, const Options& options = {}) {
+        static_assert(dimension::is_dimension<T>::value);
+
+        detail::Cursor in(path, options.block);
+        if (not in.good()) { return std::nullopt; }
+
+        std::array<char, 84> preamble;
+        if (not in.bytes(preamble.data(), preamble.size())) { return std::nullopt; }
+
+        bool swap = std::endian::native == std::endian::big;
+        std::uint32_t count = detail::decode<std::uint32_t>(preamble.data() + 80, swap);
+
+        detail::Quantizer<T, std::remove_reference_t<F>> q(emit, options);
+        std::array<char, 50> facet;
+        for (std::uint32_t i = 0; i < count; i++) {
+            if (not in.bytes(facet.data(), facet.size())) { return std::nullopt; }
+
+            for (std::size_t v = 0; v < 3; v++) {
+                const char* xyz = facet.data() + 12 + (12 * v);
+                if (not q.add(
+                          detail::decode<float>(xyz,     swap)
+                        , detail::decode<float>(xyz + 4, swap)
+                        , detail::decode<float>(xyz + 8, swap)
+                        ))
+                {
+                    return std::nullopt;
+                }
+            }
+        }
+        if (in.failed()) { return std::nullopt; }
+
+        q.flush();
+        return q.total();
+    }
+
+    // Streams the x, y and z properties of the vertex element of an ASCII
+    // or binary PLY file, like stl.
+    template <typename T, typename F>
+    inline std::optional<std::size_t>
+    ply(const std::string& path, F&& emit, const Options& options = {}) {
+        static_assert(dimension::is_dimension<T>::value);
+
+        detail::Cursor in(path, options.block);
+        if (not in.good()) { return std::nullopt; }
+
+        std::optional<detail::ply::Header> h = detail::ply::header(in);
+        if (not h) { return std::nullopt; }
+
+        detail::Quantizer<T, std::remove_reference_t<F>> q(emit, options);
+        std::vector<double> values;
+        for (const detail::ply::Element& e : h->elements) {
+            std::array<std::optional<std::size_t>, 3> axes;
+            if (e.name == "vertex") {
+                for (std::size_t i = 0; i < e.properties.size(); i++) {
+                    const detail::ply::Property& p = e.properties[i];
+                    if (p.count) { continue; }
+                    if (p.name == "x") { axes[0] = i; }
+                    if (p.name == "y") { axes[1] = i; }
+                    if (p.name == "z") { axes[2] = i; }
+                }
+                if (not axes[0] or not axes[1] or not axes[2]) { return std::nullopt; }
+            }
+
+            for (std::uint64_t i = 0; i < e.count; i++) {
+                if (not detail::ply::entry(in, *h, e, values)) { return std::nullopt; }
+                if (e.name == "vertex" and not q.add(values[*axes[0]], values[*axes[1]], values[*axes[2]])) {
+                    return std::nullopt;
+                }
+            }
+            if (e.name == "vertex") { break; }
+        }
+        if (in.failed()) { return std::nullopt; }
+
+        q.flush();
+        return q.total();
+    }
+
+    // Streams the geometric vertices of an OBJ file, like stl. Every other
+    // statement is ignored.
+    template <typename T, typename F>
+    inline std::optional<std::size_t>
+    obj(const std::string& path, F&& emit, const Options& options = {}) {
+        static_assert(dimension::is_dimension<T>::value);
+
+        detail::Cursor in(path, options.block);
+        if (not in.good()) { return std::nullopt; }
+
+        detail::Quantizer<T, std::remove_reference_t<F>> q(emit, options);
+        for (std::optional<std::string_view> l = in.line(); l; l = in.line()) {
+            std::string_view rest = *l;
+            if (detail::token(rest) != "v") { continue; }
+
+            std::array<double, 3> c;
+            for (double& value : c) {
+                if (not detail::number(rest, value)) { return std::nullopt; }
+            }
+            if (not q.add(c[0], c[1], c[2])) { return std::nullopt; }
+        }
+        if (in.failed()) { return std::nullopt; }
+
+        q.flush();
+        return q.total();
+    }
+} // namespace io
+} // namespace paulista
+
+#endif // PAULISTA_IMPORT_HPP__
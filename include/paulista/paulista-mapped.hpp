@@ -0,0 +1,284 @@
+#ifndef PAULISTA_MAPPED_HPP__
+#define PAULISTA_MAPPED_HPP__
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <optional>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "paulista-box.hpp"
+#include "paulista-cloud.hpp"
+#include "paulista-point.hpp"
+
+namespace paulista {
+namespace io {
+    enum class Layout : std::uint32_t {
+          aos = 0
+        , soa = 1
+    };
+
+    // Fixed 64 byte header of a point file, in native little endian order.
+    // The coordinates follow right after it: count points of three int32_t
+    // each for Layout::aos, or three lanes of round8(count) coordinates
+    // padded with copies of the first point for Layout::soa, so that every
+    // lane keeps the 32 byte alignment of the mapping.
+    struct Header {
+        std::array<char, 8>             magic;
+        std::uint32_t                   version;
+        Layout                          layout;
+        std::int64_t                    num;
+        std::int64_t                    den;
+        std::uint64_t                   count;
+        std::array<std::int32_t, 3>     lower;
+        std::array<std::int32_t, 3>     upper;
+    };
+
+namespace detail {
+    static_assert(std::endian::native == std::endian::little);
+    static_assert(sizeof(Header) == 64 and std::is_trivially_copyable_v<Header>);
+
+    constexpr std::array<char, 8>   magic   = {'P', 'A', 'U', 'L', 'I', 'S', 'T', 'A'};
+    constexpr std::uint32_t         version = 1;
+    constexpr std::uint64_t         width   = tridimensional::cloud::detail::width;
+
+    inline std::uint64_t
+    padded(std::uint64_t count) {
+        return ((count + width - 1) / width) * width;
+    }
+
+    // Bytes of coordinates that follow a header, or nothing for an unknown
+    // layout or a count whose size does not fit in 64 bits.
+    inline std::optional<std::uint64_t>
+    payload(const Header& h) {
+        constexpr std::uint64_t limit = std::numeric_limits<std::uint64_t>::max() / (3 * sizeof(std::int32_t));
+
+        if (h.count > limit - width) {
+            return std::nullopt;
+        } else if (h.layout == Layout::aos) {
+            return 3 * sizeof(std::int32_t) * h.count;
+        } else if (h.layout == Layout::soa) {
+            return 3 * sizeof(std::int32_t) * padded(h.count);
+        } else {
+            return std::nullopt;
+        }
+    }
+
+    // Whether the padding of every soa lane repeats its first coordinate,
+    // which the cloud kernels rely on when they read whole blocks.
+    inline bool
+    padding(const Header& h, const std::int32_t* xs) {
+        std::uint64_t lane = padded(h.count);
+        for (std::uint64_t k = 0; k < 3; k++) {
+            const std::int32_t* cs = xs + (k * lane);
+            for (std::uint64_t i = h.count; i < lane; i++) {
+                if (cs[i] != cs[0]) { return false; }
+            }
+        }
+        return true;
+    }
+} // namespace detail
+
+    // Read only mapping of a point file. The mapping lives as long as the
+    // object, and so do the views it hands out.
+    template <typename T>
+    class Mapped {
+        static_assert(dimension::is_dimension<T>::value);
+        public:
+            Mapped(const Mapped&) = delete;
+            Mapped& operator=(const Mapped&) = delete;
+
+            Mapped(Mapped&& other) noexcept
+                : data_(std::exchange(other.data_, nullptr))
+                , length_(std::exchange(other.length_, 0))
+            {}
+
+            Mapped&
+            operator=(Mapped&& other) noexcept {
+                std::swap(data_, other.data_);
+                std::swap(length_, other.length_);
+                return *this;
+            }
+
+            ~Mapped() {
+                if (data_ != nullptr) { ::munmap(data_, length_); }
+            }
+
+            const Header&
+            header() const {
+                return *static_cast<const Header*>(data_);
+            }
+
+            Layout          layout() const  { return header().layout; }
+            std::size_t     size() const    { return header().count; }
+            bool            empty() const   { return size() == 0; }
+
+            tridimensional::Box<T>
+            bounds() const {
+                const Header& h = header();
+                return tridimensional::Box<T>(
+                          tridimensional::Point<T>(h.lower[0], h.lower[1], h.lower[2])
+                        , tridimensional::Point<T>(h.upper[0], h.upper[1], h.upper[2])
+                        );
+            }
+
+            // Points of an aos file, empty for any other layout.
+            std::span<const tridimensional::Point<T>>
+            points() const {
+                if (layout() != Layout::aos) { return {}; }
+
+                return {reinterpret_cast<const tridimensional::Point<T>*>(coordinates()), size()};
+            }
+
+            // Points of an soa file, empty for any other layout. Nothing
+            // checks the bounds of the header against the points, so the
+            // view takes the widest reach rather than trust them.
+            tridimensional::PointCloudView<T>
+            cloud() const {
+                if (layout() != Layout::soa) { return {}; }
+
+                std::size_t lane = detail::padded(size());
+                const std::int32_t* xs = coordinates();
+                return {xs, xs + lane, xs + (2 * lane), size(), lane};
+            }
+        private:
+            template <typename U>
+            friend std::optional<Mapped<U>> map(const std::string& path);
+
+            Mapped(void* data, std::size_t length) : data_(data), length_(length) {}
+
+            const std::int32_t*
+            coordinates() const {
+                return reinterpret_cast<const std::int32_t*>(static_cast<const char*>(data_) + sizeof(Header));
+            }
+
+            void*       data_;
+            std::size_t length_;
+    };
+
+    // Maps the point file at path. Returns nothing when it cannot be
+    // mapped, is not a point file of this version, holds another unit than
+    // T, is shorter than its header claims, or pads its soa lanes with
+    // anything but the first point.
+    template <typename T>
+    inline std::optional<Mapped<T>>
+    map(const std::string& path) {
+        static_assert(sizeof(tridimensional::Point<T>) == 3 * sizeof(std::int32_t));
+        static_assert(std::is_standard_layout_v<tridimensional::Point<T>>);
+
+        int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) { return std::nullopt; }
+
+        struct stat status;
+        if (::fstat(fd, &status) != 0 or static_cast<std::uint64_t>(status.st_size) < sizeof(Header)) {
+            ::close(fd);
+            return std::nullopt;
+        }
+
+        std::size_t length = static_cast<std::size_t>(status.st_size);
+        void* data = ::mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (data == MAP_FAILED) { return std::nullopt; }
+
+        Mapped<T> m(data, length);
+
+        const Header& h = m.header();
+        std::optional<std::uint64_t> bytes = detail::payload(h);
+        if (    (h.magic != detail::magic)
+            or  (h.version != detail::version)
+            or  (h.num != T::ratio::num)
+            or  (h.den != T::ratio::den)
+            or  (not bytes)
+            or  (length - sizeof(Header) < *bytes)
+            or  (h.layout == Layout::soa and not detail::padding(h, m.coordinates()))
+            )
+        {
+            return std::nullopt;
+        }
+        return m;
+    }
+
+    // Writes ps to a point file at path, replacing it. Returns false when
+    // the file cannot be written.
+    template <typename T>
+    inline bool
+    save(const std::string& path, std::span<const tridimensional::Point<T>> ps, Layout layout = Layout::soa) {
+        static_assert(dimension::is_dimension<T>::value);
+
+        Header h = {
+              detail::magic
+            , detail::version
+            , layout
+            , T::ratio::num
+            , T::ratio::den
+            , ps.size()
+            , {0, 0, 0}
+            , {0, 0, 0}
+            };
+        if (not ps.empty()) {
+            h.lower = {
+                  std::numeric_limits<std::int32_t>::max()
+                , std::numeric_limits<std::int32_t>::max()
+                , std::numeric_limits<std::int32_t>::max()
+                };
+            h.upper = {
+                  std::numeric_limits<std::int32_t>::min()
+                , std::numeric_limits<std::int32_t>::min()
+                , std::numeric_limits<std::int32_t>::min()
+                };
+            for (const tridimensional::Point<T>& p : ps) {
+                std::array<std::int32_t, 3> c = {
+                      static_cast<std::int32_t>(p.x())
+                    , static_cast<std::int32_t>(p.y())
+                    , static_cast<std::int32_t>(p.z())
+                    };
+                for (std::size_t k = 0; k < 3; k++) {
+                    h.lower[k] = std::min(h.lower[k], c[k]);
+                    h.upper[k] = std::max(h.upper[k], c[k]);
+                }
+            }
+        }
+
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out.write(reinterpret_cast<const char*>(&h), sizeof(Header));
+
+        if (layout == Layout::aos) {
+            out.write(reinterpret_cast<const char*>(ps.data()), ps.size_bytes());
+        } else {
+            std::size_t lane = detail::padded(ps.size());
+            std::vector<std::int32_t> buffer(lane);
+            for (std::size_t k = 0; k < 3; k++) {
+                for (std::size_t i = 0; i < lane; i++) {
+                    const tridimensional::Point<T>& p = ps[i < ps.size() ? i : 0];
+                    buffer[i] = static_cast<std::int32_t>(k == 0 ? p.x() : (k == 1 ? p.y() : p.z()));
+                }
+                out.write(reinterpret_cast<const char*>(buffer.data()), lane * sizeof(std::int32_t));
+            }
+        }
+        out.close();
+        return not out.fail();
+    }
+
+    template <typename T>
+    inline bool
+    save(const std::string& path, const std::vector<tridimensional::Point<T>>& ps, Layout layout = Layout::soa) {
+        return save(path, std::span<const tridimensional::Point<T>>(ps), layout);
+    }
+} // namespace io
+} // namespace paulista
+
+#endif // PAULISTA_MAPPED_HPP__
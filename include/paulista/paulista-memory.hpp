@@ -0,0 +1,159 @@
+#ifndef PAULISTA_MEMORY_HPP__
+#define PAULISTA_MEMORY_HPP__
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <optional>
+
+namespace paulista {
+namespace memory {
+    // Monotonic arena over a block of its own. Allocating bumps a pointer,
+    // deallocating does nothing, and reset releases everything at once.
+    // Past the block, memory comes from upstream, and the next reset grows
+    // the block to cover it, up to limit bytes, so that a steady workload
+    // stops reaching upstream after its first round while one outsized
+    // round cannot pin its peak for the lifetime of the arena; whatever
+    // overflows past the limit is returned upstream on every reset. Not
+    // thread safe.
+    class Arena : public std::pmr::memory_resource {
+        public:
+            explicit Arena(
+                      std::size_t capacity = 1 << 16
+                    , std::pmr::memory_resource* upstream = std::pmr::get_default_resource()
+                    , std::size_t limit = 1 << 24
+                    )
+                : counting_(upstream)
+                , limit_(std::max(capacity, limit))
+                , capacity_(0)
+                , block_(nullptr)
+            {
+                grow(capacity);
+            }
+
+            Arena(const Arena&) = delete;
+            Arena& operator=(const Arena&) = delete;
+
+            ~Arena() {
+                monotonic_.reset();
+                counting_.upstream->deallocate(block_, capacity_, alignment);
+            }
+
+            // Releases every allocation made since the last reset.
+            void
+            reset() {
+                monotonic_.reset();
+                grow(std::min(capacity_ + counting_.bytes, std::max(limit_, capacity_)));
+            }
+
+            // Bytes of the owned block.
+            std::size_t
+            capacity() const {
+                return capacity_;
+            }
+
+            // Bytes the owned block may grow to.
+            std::size_t
+            limit() const {
+                return limit_;
+            }
+
+            // Bytes taken from upstream since the last reset.
+            std::size_t
+            overflow() const {
+                return counting_.bytes;
+            }
+        private:
+            static constexpr std::size_t alignment = 64;
+
+            // Forwards to upstream, adding up the bytes it hands out.
+            struct Counting : public std::pmr::memory_resource {
+                explicit Counting(std::pmr::memory_resource* u) : upstream(u), bytes(0) {}
+
+                void*
+                do_allocate(std::size_t n, std::size_t a) override {
+                    bytes += n;
+                    return upstream->allocate(n, a);
+                }
+
+                void
+                do_deallocate(void* p, std::size_t n, std::size_t a) override {
+                    upstream->deallocate(p, n, a);
+                }
+
+                bool
+                do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+                    return this == &other;
+                }
+
+                std::pmr::memory_resource*  upstream;
+                std::size_t                 bytes;
+            };
+
+            void
+            grow(std::size_t capacity) {
+                if (capacity != capacity_ or block_ == nullptr) {
+                    if (block_ != nullptr) { counting_.upstream->deallocate(block_, capacity_, alignment); }
+                    capacity_   = ((std::max<std::size_t>(capacity, alignment) + alignment - 1) / alignment) * alignment;
+                    block_      = counting_.upstream->allocate(capacity_, alignment);
+                }
+                counting_.bytes = 0;
+                monotonic_.emplace(block_, capacity_, &counting_);
+            }
+
+            void*
+            do_allocate(std::size_t n, std::size_t a) override {
+                return monotonic_->allocate(n, a);
+            }
+
+            void
+            do_deallocate(void*, std::size_t, std::size_t) override {}
+
+            bool
+            do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+                return this == &other;
+            }
+
+            Counting                                        counting_;
+            std::size_t                                     limit_;
+            std::size_t                                     capacity_;
+            void*                                           block_;
+            std::optional<std::pmr::monotonic_buffer_resource> monotonic_;
+    };
+
+namespace detail {
+    inline std::atomic<std::uint64_t>&
+    epoch() {
+        static std::atomic<std::uint64_t> e = 0;
+        return e;
+    }
+} // namespace detail
+
+    // Ends the current tick. The arena of every thread is reset the next
+    // time its thread asks for it, so nothing allocated from one during a
+    // tick may be used after it; tick while no tasks are running.
+    inline void
+    tick() {
+        detail::epoch().fetch_add(1, std::memory_order_release);
+    }
+
+    // Arena of the calling thread, reset on its first use in every tick.
+    // Each keeps at most the default limit of its own between ticks.
+    inline Arena&
+    local() {
+        thread_local Arena          arena;
+        thread_local std::uint64_t  seen = detail::epoch().load(std::memory_order_acquire);
+
+        std::uint64_t current = detail::epoch().load(std::memory_order_acquire);
+        if (seen != current) {
+            arena.reset();
+            seen = current;
+        }
+        return arena;
+    }
+} // namespace memory
+} // namespace paulista
+
+#endif // PAULISTA_MEMORY_HPP__
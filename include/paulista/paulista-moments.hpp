@@ -0,0 +1,330 @@
+#ifndef PAULISTA_MOMENTS_HPP__
+#define PAULISTA_MOMENTS_HPP__
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#if defined(__x86_64__) or defined(__i386__)
+#include <immintrin.h>
+#endif
+
+#include "paulista-box.hpp"
+#include "paulista-cloud.hpp"
+#include "paulista-parallel.hpp"
+#include "paulista-point.hpp"
+
+namespace paulista {
+namespace tridimensional {
+    // First and second moments of a point set. The centroid truncates
+    // towards zero like point::centroid, and the covariance is the
+    // population covariance about the exact mean.
+    template <typename T>
+    struct Moments {
+        std::size_t                             count;
+        Point<T>                                centroid;
+        Box<T>                                  bounds;
+        std::array<std::array<double, 3>, 3>    covariance;
+    };
+namespace moments {
+namespace detail {
+    using point::int128;
+
+    // Products of coordinate pairs kept in the second moments, in the
+    // order xx, yy, zz, xy, yz, zx.
+    constexpr std::array<std::array<std::size_t, 2>, 6> pairs = {{{0, 0}, {1, 1}, {2, 2}, {0, 1}, {1, 2}, {2, 0}}};
+
+    // Exact integer sums over a run of points: 64 bits hold the first
+    // moments and 128 bits the second ones for up to 2^31 points.
+    struct Sums {
+        std::size_t                     count   = 0;
+        std::array<std::int32_t, 3>     lower   = {
+              std::numeric_limits<std::int32_t>::max()
+            , std::numeric_limits<std::int32_t>::max()
+            , std::numeric_limits<std::int32_t>::max()
+            };
+        std::array<std::int32_t, 3>     upper   = {
+              std::numeric_limits<std::int32_t>::min()
+            , std::numeric_limits<std::int32_t>::min()
+            , std::numeric_limits<std::int32_t>::min()
+            };
+        std::array<std::int64_t, 3>     first   = {};
+        std::array<int128, 6>           second  = {};
+
+        Sums&
+        operator+=(const Sums& other) {
+            count += other.count;
+            for (std::size_t k = 0; k < 3; k++) {
+                lower[k] = std::min(lower[k], other.lower[k]);
+                upper[k] = std::max(upper[k], other.upper[k]);
+                first[k] += other.first[k];
+            }
+            for (std::size_t p = 0; p < 6; p++) { second[p] += other.second[p]; }
+            return *this;
+        }
+    };
+
+    // Every kernel adds n points, stride coordinates apart, to the sums.
+    using Kernel = void (*)(
+              const std::int32_t*
+            , const std::int32_t*
+            , const std::int32_t*
+            , std::size_t
+            , std::size_t
+            , Sums&
+            );
+
+    inline void
+    scalar(
+              const std::int32_t* xs
+            , const std::int32_t* ys
+            , const std::int32_t* zs
+            , std::size_t stride
+            , std::size_t n
+            , Sums& s
+            )
+    {
+        for (std::size_t i = 0; i < n; i++) {
+            std::array<std::int64_t, 3> c = {xs[i * stride], ys[i * stride], zs[i * stride]};
+            for (std::size_t k = 0; k < 3; k++) {
+                s.lower[k] = std::min(s.lower[k], static_cast<std::int32_t>(c[k]));
+                s.upper[k] = std::max(s.upper[k], static_cast<std::int32_t>(c[k]));
+                s.first[k] += c[k];
+            }
+            for (std::size_t p = 0; p < 6; p++) { s.second[p] += c[pairs[p][0]] * c[pairs[p][1]]; }
+        }
+        s.count += n;
+    }
+
+#if defined(__x86_64__) or defined(__i386__)
+    // Gathers the coordinates of eight points, transposing them when they
+    // are interleaved.
+    __attribute__((target("avx2")))
+    inline void
+    load(const std::int32_t* xs, const std::int32_t* ys, const std::int32_t* zs, std::size_t stride, __m256i (&c)[3]) {
+        if (stride == 1) {
+            c[0] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(xs));
+            c[1] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ys));
+            c[2] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(zs));
+        } else {
+            __m256i v0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(xs));
+            __m256i v1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(xs + 8));
+            __m256i v2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(xs + 16));
+
+            __m256i x = _mm256_blend_epi32(_mm256_blend_epi32(v0, v1, 0x92), v2, 0x24);
+            __m256i y = _mm256_blend_epi32(_mm256_blend_epi32(v0, v1, 0x24), v2, 0x49);
+            __m256i z = _mm256_blend_epi32(_mm256_blend_epi32(v0, v1, 0x49), v2, 0x92);
+            c[0] = _mm256_permutevar8x32_epi32(x, _mm256_setr_epi32(0, 3, 6, 1, 4, 7, 2, 5));
+            c[1] = _mm256_permutevar8x32_epi32(y, _mm256_setr_epi32(1, 4, 7, 2, 5, 0, 3, 6));
+            c[2] = _mm256_permutevar8x32_epi32(z, _mm256_setr_epi32(2, 5, 0, 3, 6, 1, 4, 7));
+        }
+    }
+
+    // Products are exact in 64-bit lanes but their sums are not. Each one
+    // is biased by 2^63 to make it unsigned, and its high and low words are
+    // summed apart, taking 32 bits per product, so lanes accumulate a whole
+    // block before they are folded into 128 bits.
+    __attribute__((target("avx2")))
+    inline void
+    avx2(
+              const std::int32_t* xs
+            , const std::int32_t* ys
+            , const std::int32_t* zs
+            , std::size_t stride
+            , std::size_t n
+            , Sums& s
+            )
+    {
+        constexpr std::size_t block = 1 << 20;
+
+        const __m256i bias  = _mm256_set1_epi64x(std::numeric_limits<std::int64_t>::min());
+        const __m256i low   = _mm256_set1_epi64x(0xffffffff);
+
+        std::size_t whole = n - (n % 8);
+        for (std::size_t begin = 0; begin < whole; begin += block) {
+            std::size_t end = std::min(whole, begin + block);
+
+            __m256i lower[3];
+            __m256i upper[3];
+            __m256i first[3];
+            for (std::size_t k = 0; k < 3; k++) {
+                lower[k] = _mm256_set1_epi32(s.lower[k]);
+                upper[k] = _mm256_set1_epi32(s.upper[k]);
+                first[k] = _mm256_setzero_si256();
+            }
+            __m256i high[6];
+            __m256i rest[6];
+            for (std::size_t p = 0; p < 6; p++) {
+                high[p] = _mm256_setzero_si256();
+                rest[p] = _mm256_setzero_si256();
+            }
+
+            for (std::size_t i = begin; i < end; i += 8) {
+                std::size_t offset = i * stride;
+                __m256i c[3];
+                load(xs + offset, ys + offset, zs + offset, stride, c);
+
+                __m256i evens[3];
+                __m256i odds[3];
+                for (std::size_t k = 0; k < 3; k++) {
+                    lower[k] = _mm256_min_epi32(lower[k], c[k]);
+                    upper[k] = _mm256_max_epi32(upper[k], c[k]);
+                    first[k] = _mm256_add_epi64(first[k], _mm256_cvtepi32_epi64(_mm256_castsi256_si128(c[k])));
+                    first[k] = _mm256_add_epi64(first[k], _mm256_cvtepi32_epi64(_mm256_extracti128_si256(c[k], 1)));
+                    evens[k] = c[k];
+                    odds[k]  = _mm256_srli_epi64(c[k], 32);
+                }
+                for (std::size_t p = 0; p < 6; p++) {
+                    std::size_t a = pairs[p][0];
+                    std::size_t b = pairs[p][1];
+
+                    __m256i even = _mm256_xor_si256(_mm256_mul_epi32(evens[a], evens[b]), bias);
+                    __m256i odd  = _mm256_xor_si256(_mm256_mul_epi32(odds[a], odds[b]), bias);
+                    high[p] = _mm256_add_epi64(high[p], _mm256_add_epi64(_mm256_srli_epi64(even, 32), _mm256_srli_epi64(odd, 32)));
+                    rest[p] = _mm256_add_epi64(rest[p], _mm256_add_epi64(_mm256_and_si256(even, low), _mm256_and_si256(odd, low)));
+                }
+            }
+
+            alignas(32) std::int32_t bounds[2][8];
+            alignas(32) std::int64_t sums[2][4];
+            for (std::size_t k = 0; k < 3; k++) {
+                _mm256_store_si256(reinterpret_cast<__m256i*>(bounds[0]), lower[k]);
+                _mm256_store_si256(reinterpret_cast<__m256i*>(bounds[1]), upper[k]);
+                _mm256_store_si256(reinterpret_cast<__m256i*>(sums[0]), first[k]);
+                s.lower[k] = *std::min_element(bounds[0], bounds[0] + 8);
+                s.upper[k] = *std::max_element(bounds[1], bounds[1] + 8);
+                s.first[k] += sums[0][0] + sums[0][1] + sums[0][2] + sums[0][3];
+            }
+            for (std::size_t p = 0; p < 6; p++) {
+                _mm256_store_si256(reinterpret_cast<__m256i*>(sums[0]), high[p]);
+                _mm256_store_si256(reinterpret_cast<__m256i*>(sums[1]), rest[p]);
+
+                int128 total = -(static_cast<int128>(end - begin) << 63);
+                for (std::size_t l = 0; l < 4; l++) { total += (int128{sums[0][l]} << 32) + sums[1][l]; }
+                s.second[p] += total;
+            }
+            s.count += end - begin;
+        }
+
+        std::size_t offset = whole * stride;
+        scalar(xs + offset, ys + offset, zs + offset, stride, n - whole, s);
+    }
+#endif
+
+    inline Kernel
+    dispatch() {
+        static const Kernel kernel = []() -> Kernel {
+#if defined(__x86_64__) or defined(__i386__)
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx2")) { return avx2; }
+#endif
+            return scalar;
+        }();
+        return kernel;
+    }
+
+    // Sums the n points in one task per partition of the pool, merging
+    // the partial sums in task order.
+    inline Sums
+    reduce(
+              const std::int32_t* xs
+            , const std::int32_t* ys
+            , const std::int32_t* zs
+            , std::size_t stride
+            , std::size_t n
+            , parallel::Pool& pool
+            )
+    {
+        std::size_t k = parallel::partitions(n, pool.size());
+        std::vector<Sums> partial(k);
+
+        Kernel kernel = dispatch();
+        pool.run(k, [&](std::size_t i) {
+            std::size_t begin   = (n * i) / k;
+            std::size_t end     = (n * (i + 1)) / k;
+            std::size_t offset  = begin * stride;
+            kernel(xs + offset, ys + offset, zs + offset, stride, end - begin, partial[i]);
+        });
+
+        Sums s;
+        for (const Sums& p : partial) { s += p; }
+        return s;
+    }
+
+    // The covariance numerators n * sum(ab) - sum(a) * sum(b) are exact in
+    // 128 bits, so the only rounding is the final division.
+    template <typename T>
+    inline Moments<T>
+    finish(const Sums& s) {
+        std::int64_t n = static_cast<std::int64_t>(s.count);
+        double squared = static_cast<double>(n) * static_cast<double>(n);
+
+        Moments<T> m = {
+              s.count
+            , Point<T>(
+                  static_cast<std::int32_t>(s.first[0] / n)
+                , static_cast<std::int32_t>(s.first[1] / n)
+                , static_cast<std::int32_t>(s.first[2] / n)
+                )
+            , Box<T>(
+                  Point<T>(s.lower[0], s.lower[1], s.lower[2])
+                , Point<T>(s.upper[0], s.upper[1], s.upper[2])
+                )
+            , {}
+            };
+        for (std::size_t p = 0; p < 6; p++) {
+            std::size_t a = pairs[p][0];
+            std::size_t b = pairs[p][1];
+
+            int128 numerator = (int128{n} * s.second[p]) - (int128{s.first[a]} * s.first[b]);
+            m.covariance[a][b] = static_cast<double>(numerator) / squared;
+            m.covariance[b][a] = m.covariance[a][b];
+        }
+        return m;
+    }
+} // namespace detail
+
+    // Centroid, bounds and covariance of ps in a single parallel pass.
+    // Returns nothing for an empty set.
+    template <typename T>
+    inline std::optional<Moments<T>>
+    reduce(std::span<const Point<T>> ps, parallel::Pool& pool = parallel::pool()) {
+        static_assert(dimension::is_dimension<T>::value);
+        static_assert(sizeof(Point<T>) == 3 * sizeof(std::int32_t) and std::is_standard_layout_v<Point<T>>);
+
+        if (ps.empty()) { return std::nullopt; }
+
+        const std::int32_t* data = reinterpret_cast<const std::int32_t*>(ps.data());
+        return detail::finish<T>(detail::reduce(data, data + 1, data + 2, 3, ps.size(), pool));
+    }
+
+    template <typename T>
+    inline std::optional<Moments<T>>
+    reduce(const std::vector<Point<T>>& ps, parallel::Pool& pool = parallel::pool()) {
+        return reduce(std::span<const Point<T>>(ps), pool);
+    }
+
+    template <typename T>
+    inline std::optional<Moments<T>>
+    reduce(const PointCloudView<T>& ps, parallel::Pool& pool = parallel::pool()) {
+        if (ps.empty()) { return std::nullopt; }
+
+        return detail::finish<T>(detail::reduce(ps.xs(), ps.ys(), ps.zs(), 1, ps.size(), pool));
+    }
+
+    template <typename T>
+    inline std::optional<Moments<T>>
+    reduce(const PointCloud<T>& ps, parallel::Pool& pool = parallel::pool()) {
+        return reduce(PointCloudView<T>(ps), pool);
+    }
+} // namespace moments
+} // namespace tridimensional
+} // namespace paulista
+
+#endif // PAULISTA_MOMENTS_HPP__
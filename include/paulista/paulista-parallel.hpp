@@ -0,0 +1,165 @@
+#ifndef PAULISTA_PARALLEL_HPP__
+#define PAULISTA_PARALLEL_HPP__
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace paulista {
+namespace parallel {
+    constexpr std::size_t grain = 1 << 15;
+
+    inline std::size_t
+    partitions(std::size_t n, std::size_t threads, std::size_t minimum = grain) {
+        return std::max<std::size_t>(1, std::min(threads, n / std::max<std::size_t>(1, minimum)));
+    }
+
+    // Persistent workers sharing the tasks of one run at a time. Tasks are
+    // handed out through an atomic counter, so uneven tasks balance out,
+    // and the calling thread takes part in every run. A run started from
+    // inside a task executes inline on that thread.
+    class Pool {
+        public:
+            explicit Pool(std::size_t threads = std::thread::hardware_concurrency())
+                : generation_(0)
+                , busy_(0)
+                , next_(0)
+                , total_(0)
+                , call_(nullptr)
+                , context_(nullptr)
+            {
+                std::size_t n = std::max<std::size_t>(1, threads);
+                workers_.reserve(n - 1);
+                for (std::size_t i = 1; i < n; i++) {
+                    workers_.emplace_back([this](std::stop_token stop) { work(stop); });
+                }
+            }
+
+            Pool(const Pool&) = delete;
+            Pool& operator=(const Pool&) = delete;
+
+            ~Pool() {
+                for (std::jthread& w : workers_) { w.request_stop(); }
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    generation_++;
+                }
+                wake_.notify_all();
+            }
+
+            std::size_t
+            size() const {
+                return workers_.size() + 1;
+            }
+
+            // Calls f(i) for every i in [0, k), returning once all calls
+            // have finished. If any call throws, the tasks not yet started
+            // are skipped and the first exception is rethrown here.
+            template <typename F>
+            void
+            run(std::size_t k, F&& f) {
+                if (k == 0) { return; }
+
+                if (inside_ or workers_.empty() or k == 1) {
+                    for (std::size_t i = 0; i < k; i++) { f(i); }
+                    return;
+                }
+
+                std::lock_guard<std::mutex> serial(serial_);
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    next_.store(0, std::memory_order_relaxed);
+                    total_      = k;
+                    context_    = &f;
+                    call_       = [](void* context, std::size_t i) { (*static_cast<std::remove_reference_t<F>*>(context))(i); };
+                    error_      = nullptr;
+                    busy_       = workers_.size();
+                    generation_++;
+                }
+                wake_.notify_all();
+
+                inside_ = true;
+                drain();
+                inside_ = false;
+
+                std::unique_lock<std::mutex> lock(mutex_);
+                done_.wait(lock, [this]() { return busy_ == 0; });
+                if (error_) { std::rethrow_exception(std::exchange(error_, nullptr)); }
+            }
+        private:
+            void
+            drain() {
+                for (std::size_t i = next_.fetch_add(1, std::memory_order_relaxed); i < total_; i = next_.fetch_add(1, std::memory_order_relaxed)) {
+                    try {
+                        call_(context_, i);
+                    } catch (...) {
+                        next_.store(total_, std::memory_order_relaxed);
+                        std::lock_guard<std::mutex> lock(mutex_);
+                        if (not error_) { error_ = std::current_exception(); }
+                    }
+                }
+            }
+
+            void
+            work(std::stop_token stop) {
+                inside_ = true;
+
+                std::uint64_t seen = 0;
+                while (true) {
+                    {
+                        std::unique_lock<std::mutex> lock(mutex_);
+                        wake_.wait(lock, [this, &seen]() { return generation_ != seen; });
+                        seen = generation_;
+                        if (stop.stop_requested()) { return; }
+                    }
+
+                    drain();
+
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    if (--busy_ == 0) { done_.notify_one(); }
+                }
+            }
+
+            std::mutex                  serial_;
+            std::mutex                  mutex_;
+            std::condition_variable     wake_;
+            std::condition_variable     done_;
+            std::uint64_t               generation_;
+            std::size_t                 busy_;
+            std::atomic<std::size_t>    next_;
+            std::size_t                 total_;
+            void                        (*call_)(void*, std::size_t);
+            void*                       context_;
+            std::exception_ptr          error_;
+            std::vector<std::jthread>   workers_;
+
+            // Set on threads currently running tasks of some pool.
+            static inline thread_local bool inside_ = false;
+    };
+
+    // Splits [0, n) into k contiguous ranges and calls f(i, begin, end) for
+    // each of them as one task of the pool.
+    template <typename F>
+    inline void
+    chunks(Pool& pool, std::size_t n, std::size_t k, F&& f) {
+        pool.run(k, [n, k, &f](std::size_t i) { f(i, (n * i) / k, (n * (i + 1)) / k); });
+    }
+
+    // Process wide pool with one thread per hardware thread.
+    inline Pool&
+    pool() {
+        static Pool p;
+        return p;
+    }
+} // namespace parallel
+} // namespace paulista
+
+#endif // PAULISTA_PARALLEL_HPP__
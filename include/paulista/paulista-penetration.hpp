@@ -0,0 +1,267 @@
+#ifndef PAULISTA_PENETRATION_HPP__
+#define PAULISTA_PENETRATION_HPP__
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <variant>
+
+#include "paulista-collision.hpp"
+#include "paulista-point.hpp"
+#include "paulista-simplex.hpp"
+
+namespace paulista {
+namespace collision {
+    // Translating xs by -depth along the unit normal separates the shapes,
+    // and the witness points satisfy x - y = depth * normal.
+    struct Contact {
+        double                  depth;
+        std::array<double, 3>   normal;
+        std::array<double, 3>   x;
+        std::array<double, 3>   y;
+    };
+
+namespace detail {
+    inline Real
+    normalize(const Real& v) {
+        double length = std::sqrt(v.dot(v));
+        return length == 0.0 ? Real{0.0, 0.0, 0.0} : v * (1.0 / length);
+    }
+
+    inline Real
+    cross(const Real& u, const Real& v) {
+        return {
+              (u.y * v.z) - (u.z * v.y)
+            , (u.z * v.x) - (u.x * v.z)
+            , (u.x * v.y) - (u.y * v.x)
+            };
+    }
+
+    // Expanding polytope over the Minkowski difference, kept in fixed size
+    // buffers. Faces are wound so that orient3d(a, b, c, p) is positive for
+    // points p outside of them.
+    template <typename T>
+    struct Expanding {
+        static constexpr std::size_t capacity = 128;
+
+        struct Face {
+            std::array<std::size_t, 3>  v;
+            Real                        normal;
+            double                      distance;
+        };
+
+        std::array<Vertex<T>, capacity>                     vertices;
+        std::size_t                                         count = 0;
+        std::array<Face, 2 * capacity>                      faces;
+        std::size_t                                         size = 0;
+        std::array<std::array<std::size_t, 2>, 2 * capacity> horizon;
+
+        const tridimensional::Point<T>&
+        at(std::size_t i) const {
+            return vertices[i].a;
+        }
+
+        int
+        side(const Face& f, const tridimensional::Point<T>& p) const {
+            return tridimensional::point::orient3d(at(f.v[0]), at(f.v[1]), at(f.v[2]), p);
+        }
+
+        void
+        add(std::size_t a, std::size_t b, std::size_t c) {
+            Wide n = (widen(at(b)) - widen(at(a))).cross(widen(at(c)) - widen(at(a)));
+            Real u = normalize(Real{static_cast<double>(n.x), static_cast<double>(n.y), static_cast<double>(n.z)});
+
+            double distance = n.zero() ? std::numeric_limits<double>::infinity() : u.dot(real(at(a)));
+            faces[size++] = Face{{a, b, c}, u, distance};
+        }
+
+        // Replaces the faces visible from vertex p with a fan joining p to
+        // their horizon. Visibility is decided once per face, and an edge
+        // of a visible face is on the horizon unless another visible face
+        // runs along it the other way.
+        void
+        expand(std::size_t p) {
+            std::array<bool, 2 * capacity>          visible;
+            std::array<std::size_t, 2 * capacity>   lit;
+            std::size_t                             n = 0;
+            for (std::size_t i = 0; i < size; i++) {
+                visible[i] = side(faces[i], at(p)) > 0;
+                if (visible[i]) { lit[n++] = i; }
+            }
+
+            std::size_t edges = 0;
+            for (std::size_t a = 0; a < n; a++) {
+                const Face& f = faces[lit[a]];
+                for (std::size_t k = 0; k < 3; k++) {
+                    std::size_t u = f.v[k];
+                    std::size_t v = f.v[(k + 1) % 3];
+
+                    bool shared = false;
+                    for (std::size_t b = 0; b < n and not shared; b++) {
+                        const Face& g = faces[lit[b]];
+                        for (std::size_t l = 0; l < 3; l++) {
+                            if (g.v[l] == v and g.v[(l + 1) % 3] == u) { shared = true; }
+                        }
+                    }
+                    if (not shared) { horizon[edges++] = {u, v}; }
+                }
+            }
+
+            std::size_t kept = 0;
+            for (std::size_t i = 0; i < size; i++) {
+                if (not visible[i]) { faces[kept++] = faces[i]; }
+            }
+            size = kept;
+
+            for (std::size_t i = 0; i < edges; i++) { add(horizon[i][0], horizon[i][1], p); }
+        }
+    };
+
+    template <typename T>
+    inline Contact
+    contact(const std::array<Vertex<T>, 3>& vs, std::size_t count, const Real& normal, double depth) {
+        std::array<Real, 3> as = {real(vs[0].a), real(vs[1].a), real(vs[2].a)};
+        std::array<double, 3> w = weights(as, count, normal * depth);
+
+        Real x = {0.0, 0.0, 0.0};
+        Real y = {0.0, 0.0, 0.0};
+        for (std::size_t i = 0; i < count; i++) {
+            x = x + (real(vs[i].x) * w[i]);
+            y = y + (real(vs[i].y) * w[i]);
+        }
+        return Contact{
+              std::max(0.0, depth)
+            , {normal.x, normal.y, normal.z}
+            , {x.x, x.y, x.z}
+            , {y.x, y.y, y.z}
+            };
+    }
+} // namespace detail
+
+    // Penetration depth, normal and witness points of two intersecting
+    // shapes, expanding the terminal GJK simplex into a polytope until the
+    // face nearest to the origin can no longer be pushed outwards. Returns
+    // nothing for empty or disjoint shapes.
+    template <SupportMappable X, SupportMappable Y>
+        requires std::same_as<typename X::value_type, typename Y::value_type>
+    inline std::optional<Contact>
+    penetration(const X& xs, const Y& ys) {
+        using T = detail::unit_of<X>;
+
+        if (detail::empty(xs) or detail::empty(ys)) { return std::nullopt; }
+
+        std::array<detail::Vertex<T>, detail::iterations + 1> records;
+        std::size_t recorded = 0;
+        auto record = [&records, &recorded](const tridimensional::Point<T>& x, const tridimensional::Point<T>& y) {
+            if (recorded < records.size()) { records[recorded++] = {detail::difference(x, y), x, y}; }
+        };
+
+        std::optional<detail::Step<T>> step = detail::gjk<T>(xs, ys, record);
+        if (not step) { return std::nullopt; }
+
+        detail::Expanding<T> e;
+        detail::Corners<T> cs = std::visit(detail::corners<T>{}, step->simplex);
+        for (std::size_t i = 0; i < cs.count; i++) {
+            for (std::size_t j = 0; j < recorded; j++) {
+                if (records[j].a == cs.points[i]) { e.vertices[e.count++] = records[j]; break; }
+            }
+        }
+
+        auto probe = [&xs, &ys](const detail::Real& direction) -> std::optional<detail::Vertex<T>> {
+            tridimensional::Vector<T> v = detail::narrow<T>(direction);
+            if (v == tridimensional::Vector<T>()) { return std::nullopt; }
+
+            tridimensional::Point<T> x = *support(xs,  v);
+            tridimensional::Point<T> y = *support(ys, -v);
+            return detail::Vertex<T>{detail::difference(x, y), x, y};
+        };
+
+        // A GJK simplex short of a tetrahedron holds the origin on its
+        // boundary; it is grown along directions leaving its affine hull,
+        // unless the Minkowski difference itself is flat.
+        detail::Real flat = {1.0, 0.0, 0.0};
+        while (e.count < 4) {
+            std::array<detail::Real, 6> directions = {};
+            std::size_t candidates = 0;
+            if (e.count == 1) {
+                directions = {{{1, 0, 0}, {-1, 0, 0}, {0, 1, 0}, {0, -1, 0}, {0, 0, 1}, {0, 0, -1}}};
+                candidates = 6;
+            } else if (e.count == 2) {
+                detail::Real d = detail::real(e.at(1)) - detail::real(e.at(0));
+                for (const detail::Real& axis : {detail::Real{1, 0, 0}, detail::Real{0, 1, 0}, detail::Real{0, 0, 1}}) {
+                    detail::Real n = detail::normalize(detail::cross(d, axis));
+                    directions[candidates++] = n;
+                    directions[candidates++] = -n;
+                }
+            } else {
+                detail::Real n = detail::normalize(detail::cross(
+                          detail::real(e.at(1)) - detail::real(e.at(0))
+                        , detail::real(e.at(2)) - detail::real(e.at(0))
+                        ));
+                directions[candidates++] = n;
+                directions[candidates++] = -n;
+            }
+
+            std::optional<detail::Vertex<T>> next = std::nullopt;
+            for (std::size_t i = 0; i < candidates and not next; i++) {
+                std::optional<detail::Vertex<T>> p = probe(directions[i]);
+                if (not p) { continue; }
+
+                bool grows = false;
+                if (e.count == 1) {
+                    grows = not (p->a == e.at(0));
+                } else if (e.count == 2) {
+                    detail::Wide u = detail::widen(e.at(1)) - detail::widen(e.at(0));
+                    grows = not u.cross(detail::widen(p->a) - detail::widen(e.at(0))).zero();
+                } else {
+                    grows = tridimensional::point::orient3d(e.at(0), e.at(1), e.at(2), p->a) != 0;
+                }
+
+                if (grows) { next = p; } else if (directions[i].dot(directions[i]) > 0.0) { flat = directions[i]; }
+            }
+
+            if (not next) {
+                std::array<detail::Vertex<T>, 3> vs = {e.vertices[0], e.vertices[1], e.vertices[2]};
+                return detail::contact<T>(vs, e.count, detail::normalize(flat), 0.0);
+            }
+            e.vertices[e.count++] = *next;
+        }
+
+        constexpr std::array<std::array<std::size_t, 4>, 4> tetrahedron = {{
+              {0, 1, 2, 3}
+            , {0, 3, 1, 2}
+            , {0, 2, 3, 1}
+            , {1, 3, 2, 0}
+        }};
+        for (const std::array<std::size_t, 4>& f : tetrahedron) {
+            if (tridimensional::point::orient3d(e.at(f[0]), e.at(f[1]), e.at(f[2]), e.at(f[3])) > 0) {
+                e.add(f[0], f[2], f[1]);
+            } else {
+                e.add(f[0], f[1], f[2]);
+            }
+        }
+
+        while (true) {
+            std::size_t best = 0;
+            for (std::size_t i = 1; i < e.size; i++) {
+                if (e.faces[i].distance < e.faces[best].distance) { best = i; }
+            }
+            const typename detail::Expanding<T>::Face f = e.faces[best];
+
+            std::optional<detail::Vertex<T>> p = probe(f.normal);
+            if (not p or e.count == e.capacity or e.side(f, p->a) <= 0) {
+                std::array<detail::Vertex<T>, 3> vs = {e.vertices[f.v[0]], e.vertices[f.v[1]], e.vertices[f.v[2]]};
+                return detail::contact<T>(vs, 3, f.normal, f.distance);
+            }
+
+            e.vertices[e.count] = *p;
+            e.expand(e.count++);
+        }
+    }
+} // namespace collision
+} // namespace paulista
+
+#endif // PAULISTA_PENETRATION_HPP__
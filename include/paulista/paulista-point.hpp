@@ -1,11 +1,22 @@
 #ifndef PAULISTA_POINT_HPP__
 #define PAULISTA_POINT_HPP__
 
+#include <array>
+#include <cmath>
+#include <cstddef>
 #include <cstdint>
+#include <limits>
 #include <optional>
 #include <ostream>
+#include <ratio>
+#include <span>
+#include <type_traits>
 #include <vector>
 
+#if defined(__x86_64__) or defined(__i386__)
+#include <immintrin.h>
+#endif
+
 #include "paulista-dimension.hpp"
 
 namespace paulista {
@@ -17,6 +28,10 @@ namespace tridimensional {
             Point() : x_(0), y_(0), z_(0) {}
             Point(T x, T y, T z) : x_(x), y_(y), z_(z) {}
 
+            T x() const { return x_; }
+            T y() const { return y_; }
+            T z() const { return z_; }
+
             friend bool
             operator==(const Point<T>& lhs, const Point<T>& rhs) {
                 return  (lhs.x_ == rhs.x_)
@@ -138,7 +153,104 @@ namespace tridimensional {
             T y_;
             T z_;
     };
+
+    template <typename T>
+    using Vector = Point<T>;
 namespace point {
+    __extension__ typedef __int128 int128;
+
+    // Exact counterparts of Point::dot and Point::cross, which overflow the
+    // 32-bit unit type for coordinates past +-46340. Each product of 32-bit
+    // coordinates takes 63 bits and their sum up to 65, so the dot product
+    // is summed in 128 bits; a 64-bit cross is exact for any pair of 32-bit
+    // points.
+    template <typename T>
+    inline int128
+    dot(const Point<T>& p, const Point<T>& q) {
+        return  (int128{std::int64_t{static_cast<std::int32_t>(p.x())} * static_cast<std::int32_t>(q.x())})
+            +   (int128{std::int64_t{static_cast<std::int32_t>(p.y())} * static_cast<std::int32_t>(q.y())})
+            +   (int128{std::int64_t{static_cast<std::int32_t>(p.z())} * static_cast<std::int32_t>(q.z())})
+            ;
+    }
+
+    template <typename T>
+    inline std::array<std::int64_t, 3>
+    cross(const Point<T>& p, const Point<T>& q) {
+        std::int64_t px = static_cast<std::int32_t>(p.x());
+        std::int64_t py = static_cast<std::int32_t>(p.y());
+        std::int64_t pz = static_cast<std::int32_t>(p.z());
+        std::int64_t qx = static_cast<std::int32_t>(q.x());
+        std::int64_t qy = static_cast<std::int32_t>(q.y());
+        std::int64_t qz = static_cast<std::int32_t>(q.z());
+        return {(py * qz) - (pz * qy), (pz * qx) - (px * qz), (px * qy) - (py * qx)};
+    }
+
+    // Six times the signed volume of the tetrahedron abcd, positive when d
+    // lies on the side of the plane abc that (b - a) x (c - a) points to.
+    // Differences take 33 bits and the determinant at most 99, so 128 bits
+    // are exact for any 32-bit points.
+    template <typename T>
+    inline int128
+    volume(const Point<T>& a, const Point<T>& b, const Point<T>& c, const Point<T>& d) {
+        auto difference = [&a](const Point<T>& p) {
+            return std::array<int128, 3>{
+                  std::int64_t{static_cast<std::int32_t>(p.x())} - static_cast<std::int32_t>(a.x())
+                , std::int64_t{static_cast<std::int32_t>(p.y())} - static_cast<std::int32_t>(a.y())
+                , std::int64_t{static_cast<std::int32_t>(p.z())} - static_cast<std::int32_t>(a.z())
+                };
+        };
+        std::array<int128, 3> u = difference(b);
+        std::array<int128, 3> v = difference(c);
+        std::array<int128, 3> w = difference(d);
+        return  (w[0] * ((u[1] * v[2]) - (u[2] * v[1])))
+            +   (w[1] * ((u[2] * v[0]) - (u[0] * v[2])))
+            +   (w[2] * ((u[0] * v[1]) - (u[1] * v[0])))
+            ;
+    }
+
+    // Sign of volume(a, b, c, d). The determinant is first evaluated in
+    // doubles, where the differences are exact, and trusted whenever it
+    // exceeds Shewchuk's forward error bound on that evaluation; only
+    // nearly flat tetrahedra fall back to 128-bit arithmetic.
+    template <typename T>
+    inline int
+    orient3d(const Point<T>& a, const Point<T>& b, const Point<T>& c, const Point<T>& d) {
+        auto difference = [&a](const Point<T>& p) {
+            return std::array<double, 3>{
+                  static_cast<double>(static_cast<std::int32_t>(p.x())) - static_cast<std::int32_t>(a.x())
+                , static_cast<double>(static_cast<std::int32_t>(p.y())) - static_cast<std::int32_t>(a.y())
+                , static_cast<double>(static_cast<std::int32_t>(p.z())) - static_cast<std::int32_t>(a.z())
+                };
+        };
+        std::array<double, 3> u = difference(b);
+        std::array<double, 3> v = difference(c);
+        std::array<double, 3> w = difference(d);
+
+        double uv0 = u[1] * v[2];
+        double vu0 = u[2] * v[1];
+        double uv1 = u[2] * v[0];
+        double vu1 = u[0] * v[2];
+        double uv2 = u[0] * v[1];
+        double vu2 = u[1] * v[0];
+
+        double determinant  = (w[0] * (uv0 - vu0)) + (w[1] * (uv1 - vu1)) + (w[2] * (uv2 - vu2));
+        double permanent    = (std::abs(w[0]) * (std::abs(uv0) + std::abs(vu0)))
+                            + (std::abs(w[1]) * (std::abs(uv1) + std::abs(vu1)))
+                            + (std::abs(w[2]) * (std::abs(uv2) + std::abs(vu2)))
+                            ;
+
+        constexpr double epsilon = std::numeric_limits<double>::epsilon() / 2.0;
+        constexpr double bound   = (7.0 + (56.0 * epsilon)) * epsilon;
+        if (determinant > bound * permanent) {
+            return 1;
+        } else if (-determinant > bound * permanent) {
+            return -1;
+        } else {
+            int128 exact = volume(a, b, c, d);
+            return (exact > 0) - (exact < 0);
+        }
+    }
+
     template <typename T>
     inline std::optional<Point<T>>
     centroid(const std::vector<Point<T>>& ps) {
@@ -149,13 +261,153 @@ namespace point {
         } else if (ps.size() == 1) {
             return ps.front();
         } else {
-            std::int32_t denominator = ps.size();
+            std::array<std::int64_t, 3> sum = {};
+            for (const Point<T>& p : ps) {
+                sum[0] += static_cast<std::int32_t>(p.x());
+                sum[1] += static_cast<std::int32_t>(p.y());
+                sum[2] += static_cast<std::int32_t>(p.z());
+            }
 
-            Point<T> p = ps.front();
-            for (std::int32_t i = 1; i < denominator; i++) { p += ps[i]; }
-            return (p / denominator);
+            std::int64_t n = static_cast<std::int64_t>(ps.size());
+            return Point<T>(
+                      static_cast<std::int32_t>(sum[0] / n)
+                    , static_cast<std::int32_t>(sum[1] / n)
+                    , static_cast<std::int32_t>(sum[2] / n)
+                    );
         }
     };
+
+namespace detail {
+    using Kernel = bool (*)(const std::int32_t*, std::int32_t*, std::size_t);
+
+    template <typename T, typename U>
+    using factor = std::ratio_divide<typename T::ratio, typename U::ratio>;
+
+    // Coordinates whose rescaled value overflows 32 bits are wrapped, and
+    // reported through the return value.
+    template <typename T, typename U>
+    inline bool
+    scalar(const std::int32_t* in, std::int32_t* out, std::size_t n) {
+        using f = factor<T, U>;
+
+        bool fits = true;
+        for (std::size_t i = 0; i < n; i++) {
+            std::int64_t value = (std::int64_t{in[i]} * f::num) / f::den;
+            fits = fits
+                and (value >= std::numeric_limits<std::int32_t>::min())
+                and (value <= std::numeric_limits<std::int32_t>::max())
+                ;
+            out[i] = static_cast<std::int32_t>(value);
+        }
+        return fits;
+    }
+
+#if defined(__x86_64__) or defined(__i386__)
+    // Widening multiplies and checks every lane against the largest value
+    // that survives the multiplication; narrowing divides in double, which
+    // is exact for 32 bit dividends, and truncates like integer division.
+    template <typename T, typename U>
+    __attribute__((target("avx2")))
+    inline bool
+    avx2(const std::int32_t* in, std::int32_t* out, std::size_t n) {
+        using f = factor<T, U>;
+
+        std::size_t i       = 0;
+        __m256i     wrapped = _mm256_setzero_si256();
+        if constexpr (f::den == 1) {
+            const __m256i k     = _mm256_set1_epi32(static_cast<std::int32_t>(f::num));
+            const __m256i upper = _mm256_set1_epi32(static_cast<std::int32_t>(std::numeric_limits<std::int32_t>::max() / f::num));
+            const __m256i lower = _mm256_set1_epi32(static_cast<std::int32_t>(std::numeric_limits<std::int32_t>::min() / f::num));
+            for (; i + 8 <= n; i += 8) {
+                __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+                wrapped = _mm256_or_si256(wrapped, _mm256_or_si256(_mm256_cmpgt_epi32(v, upper), _mm256_cmpgt_epi32(lower, v)));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_mullo_epi32(v, k));
+            }
+        } else {
+            const __m256d k = _mm256_set1_pd(static_cast<double>(f::den));
+            for (; i + 8 <= n; i += 8) {
+                __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+                __m128i a = _mm256_cvttpd_epi32(_mm256_div_pd(_mm256_cvtepi32_pd(_mm256_castsi256_si128(v)), k));
+                __m128i b = _mm256_cvttpd_epi32(_mm256_div_pd(_mm256_cvtepi32_pd(_mm256_extracti128_si256(v, 1)), k));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_set_m128i(b, a));
+            }
+        }
+        return scalar<T, U>(in + i, out + i, n - i) and _mm256_testz_si256(wrapped, wrapped);
+    }
+
+    template <typename T, typename U>
+    __attribute__((target("sse4.2")))
+    inline bool
+    sse(const std::int32_t* in, std::int32_t* out, std::size_t n) {
+        using f = factor<T, U>;
+
+        std::size_t i       = 0;
+        __m128i     wrapped = _mm_setzero_si128();
+        if constexpr (f::den == 1) {
+            const __m128i k     = _mm_set1_epi32(static_cast<std::int32_t>(f::num));
+            const __m128i upper = _mm_set1_epi32(static_cast<std::int32_t>(std::numeric_limits<std::int32_t>::max() / f::num));
+            const __m128i lower = _mm_set1_epi32(static_cast<std::int32_t>(std::numeric_limits<std::int32_t>::min() / f::num));
+            for (; i + 4 <= n; i += 4) {
+                __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+                wrapped = _mm_or_si128(wrapped, _mm_or_si128(_mm_cmpgt_epi32(v, upper), _mm_cmplt_epi32(v, lower)));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_mullo_epi32(v, k));
+            }
+        } else {
+            const __m128d k = _mm_set1_pd(static_cast<double>(f::den));
+            for (; i + 4 <= n; i += 4) {
+                __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+                __m128i a = _mm_cvttpd_epi32(_mm_div_pd(_mm_cvtepi32_pd(v), k));
+                __m128i b = _mm_cvttpd_epi32(_mm_div_pd(_mm_cvtepi32_pd(_mm_srli_si128(v, 8)), k));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_unpacklo_epi64(a, b));
+            }
+        }
+        return scalar<T, U>(in + i, out + i, n - i) and _mm_testz_si128(wrapped, wrapped);
+    }
+#endif
+
+    // Vector kernels cover unit pairs related by an integer factor that
+    // fits in 32 bits; any other pair goes through 64 bit scalar code.
+    template <typename T, typename U>
+    inline Kernel
+    dispatch() {
+        using f = factor<T, U>;
+
+        if constexpr ((f::num != 1 and f::den != 1) or (f::num > std::numeric_limits<std::int32_t>::max())) {
+            return scalar<T, U>;
+        } else {
+            static const Kernel kernel = []() -> Kernel {
+#if defined(__x86_64__) or defined(__i386__)
+                __builtin_cpu_init();
+                if (__builtin_cpu_supports("avx2"))     { return avx2<T, U>; }
+                if (__builtin_cpu_supports("sse4.2"))   { return sse<T, U>; }
+#endif
+                return scalar<T, U>;
+            }();
+            return kernel;
+        }
+    }
+} // namespace detail
+
+    // Rescales every point of ps into qs, truncating towards zero like the
+    // unit constructors. Returns false, leaving qs untouched, when it is
+    // shorter than ps, and false, with the overflowing coordinates wrapped,
+    // when a coordinate does not fit the target unit.
+    template <typename U, typename T>
+    inline bool
+    convert(std::span<const Point<T>> ps, std::span<Point<U>> qs) {
+        static_assert(dimension::is_dimension<T>::value);
+        static_assert(dimension::is_dimension<U>::value);
+        static_assert(sizeof(Point<T>) == 3 * sizeof(std::int32_t) and std::is_standard_layout_v<Point<T>>);
+        static_assert(sizeof(Point<U>) == 3 * sizeof(std::int32_t) and std::is_standard_layout_v<Point<U>>);
+
+        if (qs.size() < ps.size()) { return false; }
+
+        return detail::dispatch<T, U>()(
+                  reinterpret_cast<const std::int32_t*>(ps.data())
+                , reinterpret_cast<std::int32_t*>(qs.data())
+                , 3 * ps.size()
+                );
+    }
 } // namespace point
 } // namespace tridimensional
 } // namespace paulista
@@ -0,0 +1,226 @@
+#ifndef PAULISTA_POLYTOPE_HPP__
+#define PAULISTA_POLYTOPE_HPP__
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory_resource>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "paulista-collision.hpp"
+#include "paulista-point.hpp"
+
+namespace paulista {
+namespace collision {
+    using Face = std::array<std::size_t, 3>;
+
+    // Convex polytope whose vertices carry their edge adjacency, so that
+    // support queries climb the vertex graph instead of scanning it. Every
+    // vertex is expected to belong to at least one face of a closed convex
+    // surface; the last answer is kept as the starting point of the next
+    // query.
+    template <typename T>
+    class Polytope {
+        static_assert(dimension::is_dimension<T>::value);
+        public:
+            using value_type = tridimensional::Point<T>;
+
+            Polytope() : hint_(0) {}
+
+            Polytope(
+                      const std::vector<tridimensional::Point<T>>& vertices
+                    , const std::vector<Face>& faces
+                    )
+                : vertices_(vertices)
+                , offsets_(vertices.size() + 1, 0)
+                , hint_(0)
+            {
+                std::vector<std::vector<std::size_t>> adjacency(vertices.size());
+                for (const Face& f : faces) {
+                    for (std::size_t i = 0; i < 3; i++) {
+                        adjacency[f[i]].push_back(f[(i + 1) % 3]);
+                        adjacency[f[(i + 1) % 3]].push_back(f[i]);
+                    }
+                }
+                for (std::size_t i = 0; i < adjacency.size(); i++) {
+                    std::sort(adjacency[i].begin(), adjacency[i].end());
+                    adjacency[i].erase(
+                              std::unique(adjacency[i].begin(), adjacency[i].end())
+                            , adjacency[i].end()
+                            );
+                    offsets_[i + 1] = offsets_[i] + adjacency[i].size();
+                }
+                neighbours_.reserve(offsets_.back());
+                for (const std::vector<std::size_t>& ns : adjacency) {
+                    neighbours_.insert(neighbours_.end(), ns.begin(), ns.end());
+                }
+            }
+
+            Polytope(const Polytope<T>& other)
+                : vertices_(other.vertices_)
+                , offsets_(other.offsets_)
+                , neighbours_(other.neighbours_)
+                , hint_(other.hint_.load(std::memory_order_relaxed))
+            {}
+
+            Polytope<T>&
+            operator=(const Polytope<T>& other) {
+                vertices_   = other.vertices_;
+                offsets_    = other.offsets_;
+                neighbours_ = other.neighbours_;
+                hint_.store(other.hint_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+                return *this;
+            }
+
+            const tridimensional::Point<T>&
+            operator[](std::size_t i) const {
+                return vertices_[i];
+            }
+
+            bool            empty() const   { return vertices_.empty(); }
+            std::size_t     size() const    { return vertices_.size(); }
+
+            const std::vector<tridimensional::Point<T>>&
+            vertices() const {
+                return vertices_;
+            }
+
+            std::size_t
+            degree(std::size_t i) const {
+                return offsets_[i + 1] - offsets_[i];
+            }
+
+            // Index of a vertex maximizing the dot product with v, reached by
+            // steepest ascent from the given start. A local maximum on the
+            // vertex graph of a convex polytope is global, except on flat
+            // regions holding non-extreme vertices, which are flooded until
+            // an ascending edge shows up.
+            std::size_t
+            climb(const tridimensional::Vector<T>& v, std::size_t start) const {
+                std::size_t  current = start;
+                tridimensional::point::int128 best = tridimensional::point::dot(vertices_[current], v);
+
+                while (true) {
+                    std::size_t from = current;
+                    for (std::size_t i = offsets_[from]; i < offsets_[from + 1]; i++) {
+                        tridimensional::point::int128 value = tridimensional::point::dot(vertices_[neighbours_[i]], v);
+                        if (value > best) { best = value; current = neighbours_[i]; }
+                    }
+                    if (current != from) { continue; }
+
+                    std::optional<std::size_t> next = plateau(v, current, best);
+                    if (not next) { return current; }
+
+                    current = *next;
+                    best    = tridimensional::point::dot(vertices_[current], v);
+                }
+            }
+
+            std::size_t
+            climb(const tridimensional::Vector<T>& v) const {
+                std::size_t i = climb(v, hint_.load(std::memory_order_relaxed));
+                hint_.store(i, std::memory_order_relaxed);
+                return i;
+            }
+        private:
+            // Set of vertex indices with linear probing over a power of two
+            // table, doubled whenever it would pass half full.
+            class Visited {
+                public:
+                    explicit Visited(std::pmr::memory_resource* resource)
+                        : slots_(16, none, resource)
+                        , size_(0)
+                    {}
+
+                    // Whether i was not in the set yet.
+                    bool
+                    insert(std::size_t i) {
+                        if (2 * (size_ + 1) > slots_.size()) { grow(); }
+                        if (not place(slots_, i)) { return false; }
+                        size_++;
+                        return true;
+                    }
+                private:
+                    static constexpr std::size_t none = std::numeric_limits<std::size_t>::max();
+
+                    static bool
+                    place(std::pmr::vector<std::size_t>& slots, std::size_t i) {
+                        std::size_t mask = slots.size() - 1;
+                        for (std::size_t k = (i * 0x9e3779b97f4a7c15ull) >> 32;; k++) {
+                            std::size_t& slot = slots[k & mask];
+                            if (slot == i)      { return false; }
+                            if (slot == none)   { slot = i; return true; }
+                        }
+                    }
+
+                    void
+                    grow() {
+                        std::pmr::vector<std::size_t> slots(2 * slots_.size(), none, slots_.get_allocator());
+                        for (std::size_t i : slots_) {
+                            if (i != none) { place(slots, i); }
+                        }
+                        slots_ = std::move(slots);
+                    }
+
+                    std::pmr::vector<std::size_t>   slots_;
+                    std::size_t                     size_;
+            };
+
+            std::optional<std::size_t>
+            plateau(const tridimensional::Vector<T>& v, std::size_t start, tridimensional::point::int128 level) const {
+                bool flat = false;
+                for (std::size_t i = offsets_[start]; i < offsets_[start + 1]; i++) {
+                    if (tridimensional::point::dot(vertices_[neighbours_[i]], v) == level) { flat = true; break; }
+                }
+                if (not flat) { return std::nullopt; }
+
+                // Plateaus are mostly a handful of vertices, whose bookkeeping
+                // fits on the stack. Flooded vertices go in an open addressing
+                // set kept at most half full, so a large plateau still costs
+                // constant time per edge.
+                std::array<std::byte, 1024> buffer;
+                std::pmr::monotonic_buffer_resource scratch(buffer.data(), buffer.size());
+                std::pmr::vector<std::size_t> frontier({start}, &scratch);
+                Visited seen(&scratch);
+                seen.insert(start);
+                while (not frontier.empty()) {
+                    std::size_t from = frontier.back();
+                    frontier.pop_back();
+
+                    for (std::size_t i = offsets_[from]; i < offsets_[from + 1]; i++) {
+                        std::size_t n = neighbours_[i];
+                        tridimensional::point::int128 value = tridimensional::point::dot(vertices_[n], v);
+                        if (value > level) {
+                            return n;
+                        } else if (value == level and seen.insert(n)) {
+                            frontier.push_back(n);
+                        }
+                    }
+                }
+                return std::nullopt;
+            }
+
+            std::vector<tridimensional::Point<T>>   vertices_;
+            std::vector<std::size_t>                offsets_;
+            std::vector<std::size_t>                neighbours_;
+            mutable std::atomic<std::size_t>        hint_;
+    };
+
+    template <typename T>
+    inline std::optional<tridimensional::Point<T>>
+    support(const Polytope<T>& ps, const tridimensional::Vector<T>& v) {
+        if (ps.empty()) {
+            return std::nullopt;
+        } else {
+            return ps[ps.climb(v)];
+        }
+    }
+} // namespace collision
+} // namespace paulista
+
+#endif // PAULISTA_POLYTOPE_HPP__
@@ -1,65 +1,72 @@
 #ifndef PAULISTA_SIMPLEX_HPP__
 #define PAULISTA_SIMPLEX_HPP__
 
+#include <variant>
+
 #include "paulista-point.hpp"
 
 namespace paulista {
 namespace simplex {
+    template <typename T>
     struct Point {
-        tridimensional::Point u;
+        tridimensional::Point<T> u;
     };
 
+    template <typename T>
     struct Line {
-        tridimensional::Point u;
-        tridimensional::Point v;
+        tridimensional::Point<T> u;
+        tridimensional::Point<T> v;
     };
 
+    template <typename T>
     struct Triangle {
-        tridimensional::Point u;
-        tridimensional::Point v;
-        tridimensional::Point w;
+        tridimensional::Point<T> u;
+        tridimensional::Point<T> v;
+        tridimensional::Point<T> w;
     };
 
+    template <typename T>
     struct Tetrahedron {
-        tridimensional::Point u;
-        tridimensional::Point v;
-        tridimensional::Point w;
-        tridimensional::Point z;
+        tridimensional::Point<T> u;
+        tridimensional::Point<T> v;
+        tridimensional::Point<T> w;
+        tridimensional::Point<T> z;
     };
 
     struct is_point {
-        bool operator()(const Point&) const         { return true; }
-        bool operator()(const Line&) const          { return false; }
-        bool operator()(const Triangle&) const      { return false; }
-        bool operator()(const Tetrahedron&) const   { return false; }
+        template <typename T> bool operator()(const Point<T>&) const         { return true; }
+        template <typename T> bool operator()(const Line<T>&) const          { return false; }
+        template <typename T> bool operator()(const Triangle<T>&) const      { return false; }
+        template <typename T> bool operator()(const Tetrahedron<T>&) const   { return false; }
     };
 
     struct is_line {
-        bool operator()(const Point&) const         { return false; }
-        bool operator()(const Line&) const          { return true; }
-        bool operator()(const Triangle&) const      { return false; }
-        bool operator()(const Tetrahedron&) const   { return false; }
+        template <typename T> bool operator()(const Point<T>&) const         { return false; }
+        template <typename T> bool operator()(const Line<T>&) const          { return true; }
+        template <typename T> bool operator()(const Triangle<T>&) const      { return false; }
+        template <typename T> bool operator()(const Tetrahedron<T>&) const   { return false; }
     };
 
     struct is_triangle {
-        bool operator()(const Point&) const         { return false; }
-        bool operator()(const Line&) const          { return false; }
-        bool operator()(const Triangle&) const      { return true; }
-        bool operator()(const Tetrahedron&) const   { return false; }
+        template <typename T> bool operator()(const Point<T>&) const         { return false; }
+        template <typename T> bool operator()(const Line<T>&) const          { return false; }
+        template <typename T> bool operator()(const Triangle<T>&) const      { return true; }
+        template <typename T> bool operator()(const Tetrahedron<T>&) const   { return false; }
     };
 
     struct is_tetrahedron {
-        bool operator()(const Point&) const         { return false; }
-        bool operator()(const Line&) const          { return false; }
-        bool operator()(const Triangle&) const      { return false; }
-        bool operator()(const Tetrahedron&) const   { return true; }
+        template <typename T> bool operator()(const Point<T>&) const         { return false; }
+        template <typename T> bool operator()(const Line<T>&) const          { return false; }
+        template <typename T> bool operator()(const Triangle<T>&) const      { return false; }
+        template <typename T> bool operator()(const Tetrahedron<T>&) const   { return true; }
     };
 } // namespace simplex
+    template <typename T>
     using Simplex = std::variant<
-          simplex::Point
-        , simplex::Line
-        , simplex::Triangle
-        , simplex::Tetrahedron
+          simplex::Point<T>
+        , simplex::Line<T>
+        , simplex::Triangle<T>
+        , simplex::Tetrahedron<T>
         >;
 } // namespace paulista
 
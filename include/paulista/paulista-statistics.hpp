@@ -0,0 +1,218 @@
+#ifndef PAULISTA_STATISTICS_HPP__
+#define PAULISTA_STATISTICS_HPP__
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace paulista {
+namespace collision {
+    // Work done by GJK queries. Transitions count the simplices queries
+    // evolved into, indexed as Point, Line, Triangle and Tetrahedron, and
+    // early outs the queries that ended on a separating direction.
+    struct Statistics {
+        std::uint64_t                   queries     = 0;
+        std::uint64_t                   supports    = 0;
+        std::uint64_t                   iterations  = 0;
+        std::uint64_t                   early_outs  = 0;
+        std::uint64_t                   longest     = 0;
+        std::array<std::uint64_t, 4>    transitions = {};
+
+        Statistics&
+        operator+=(const Statistics& other) {
+            queries     += other.queries;
+            supports    += other.supports;
+            iterations  += other.iterations;
+            early_outs  += other.early_outs;
+            longest      = std::max(longest, other.longest);
+            for (std::size_t k = 0; k < transitions.size(); k++) { transitions[k] += other.transitions[k]; }
+            return *this;
+        }
+
+        // Fraction of queries that ended early.
+        double
+        rate() const {
+            return queries == 0 ? 0.0 : static_cast<double>(early_outs) / static_cast<double>(queries);
+        }
+
+        // Iterations per query.
+        double
+        mean() const {
+            return queries == 0 ? 0.0 : static_cast<double>(iterations) / static_cast<double>(queries);
+        }
+    };
+
+namespace statistics {
+    // Counting is compiled in only when PAULISTA_STATISTICS is defined,
+    // which has to hold for every translation unit of a program alike.
+#if defined(PAULISTA_STATISTICS)
+    constexpr bool enabled = true;
+#else
+    constexpr bool enabled = false;
+#endif
+
+namespace detail {
+    // Counters of one thread. Only their thread writes them, through
+    // relaxed loads and stores that compile to plain moves, so that other
+    // threads may read them at any time.
+    struct Counters {
+        std::atomic<std::uint64_t>                  queries     = 0;
+        std::atomic<std::uint64_t>                  supports    = 0;
+        std::atomic<std::uint64_t>                  iterations  = 0;
+        std::atomic<std::uint64_t>                  early_outs  = 0;
+        std::atomic<std::uint64_t>                  longest     = 0;
+        std::array<std::atomic<std::uint64_t>, 4>   transitions = {};
+        Statistics                                  last;
+
+        static void
+        bump(std::atomic<std::uint64_t>& c, std::uint64_t n) {
+            c.store(c.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+        }
+
+        void
+        add(const Statistics& s) {
+            bump(queries, s.queries);
+            bump(supports, s.supports);
+            bump(iterations, s.iterations);
+            bump(early_outs, s.early_outs);
+            longest.store(std::max(longest.load(std::memory_order_relaxed), s.longest), std::memory_order_relaxed);
+            for (std::size_t k = 0; k < transitions.size(); k++) { bump(transitions[k], s.transitions[k]); }
+            last = s;
+        }
+
+        Statistics
+        load() const {
+            Statistics s;
+            s.queries       = queries.load(std::memory_order_relaxed);
+            s.supports      = supports.load(std::memory_order_relaxed);
+            s.iterations    = iterations.load(std::memory_order_relaxed);
+            s.early_outs    = early_outs.load(std::memory_order_relaxed);
+            s.longest       = longest.load(std::memory_order_relaxed);
+            for (std::size_t k = 0; k < transitions.size(); k++) { s.transitions[k] = transitions[k].load(std::memory_order_relaxed); }
+            return s;
+        }
+
+        void
+        clear() {
+            queries.store(0, std::memory_order_relaxed);
+            supports.store(0, std::memory_order_relaxed);
+            iterations.store(0, std::memory_order_relaxed);
+            early_outs.store(0, std::memory_order_relaxed);
+            longest.store(0, std::memory_order_relaxed);
+            for (std::atomic<std::uint64_t>& t : transitions) { t.store(0, std::memory_order_relaxed); }
+        }
+    };
+
+    // Counters of the running threads, and the totals of the threads that
+    // have exited.
+    struct Registry {
+        std::mutex              mutex;
+        std::vector<Counters*>  live;
+        Statistics              retired;
+    };
+
+    inline Registry&
+    registry() {
+        static Registry r;
+        return r;
+    }
+
+    // Registers the counters of a thread for its lifetime, folding them into
+    // the retired totals once the thread exits.
+    class Local {
+        public:
+            Local() {
+                Registry& r = registry();
+                std::lock_guard<std::mutex> lock(r.mutex);
+                r.live.push_back(&counters);
+            }
+
+            Local(const Local&) = delete;
+            Local& operator=(const Local&) = delete;
+
+            ~Local() {
+                Registry& r = registry();
+                std::lock_guard<std::mutex> lock(r.mutex);
+                r.retired += counters.load();
+                r.live.erase(std::find(r.live.begin(), r.live.end(), &counters));
+            }
+
+            Counters counters;
+    };
+
+    inline Counters&
+    local() {
+        thread_local Local l;
+        return l.counters;
+    }
+
+    // Tally of a single query, kept apart from the shared counters until
+    // the query ends.
+    template <bool Enabled = enabled>
+    class Probe {
+        public:
+            Probe() { tally_.queries = 1; }
+
+            Probe(const Probe&) = delete;
+            Probe& operator=(const Probe&) = delete;
+
+            ~Probe() {
+                tally_.longest = tally_.iterations;
+                local().add(tally_);
+            }
+
+            void support(std::uint64_t n = 2)       { tally_.supports += n; }
+            void iteration()                        { tally_.iterations++; }
+            void transition(std::size_t kind)       { tally_.transitions[kind]++; }
+            void early_out()                        { tally_.early_outs++; }
+        private:
+            Statistics tally_;
+    };
+
+    template <>
+    class Probe<false> {
+        public:
+            void support(std::uint64_t = 2)         {}
+            void iteration()                        {}
+            void transition(std::size_t)            {}
+            void early_out()                        {}
+    };
+} // namespace detail
+
+    // Merges the counters of every thread, running or exited, since the
+    // last reset. Always empty when counting is compiled out.
+    inline Statistics
+    collect() {
+        detail::Registry& r = detail::registry();
+        std::lock_guard<std::mutex> lock(r.mutex);
+        Statistics s = r.retired;
+        for (const detail::Counters* c : r.live) { s += c->load(); }
+        return s;
+    }
+
+    // Counters of the last query run on the calling thread.
+    inline Statistics
+    last() {
+        return detail::local().last;
+    }
+
+    // Clears the counters of every thread. Queries running meanwhile may
+    // be partly lost.
+    inline void
+    reset() {
+        detail::local().last = Statistics();
+
+        detail::Registry& r = detail::registry();
+        std::lock_guard<std::mutex> lock(r.mutex);
+        r.retired = Statistics();
+        for (detail::Counters* c : r.live) { c->clear(); }
+    }
+} // namespace statistics
+} // namespace collision
+} // namespace paulista
+
+#endif // PAULISTA_STATISTICS_HPP__
@@ -0,0 +1,149 @@
+#ifndef PAULISTA_SWEEP_HPP__
+#define PAULISTA_SWEEP_HPP__
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_set>
+#include <vector>
+
+#include "paulista-box.hpp"
+#include "paulista-bvh.hpp"
+#include "paulista-point.hpp"
+
+namespace paulista {
+namespace collision {
+    // Sweep and prune over the boxes of many shapes, keeping the sorted box
+    // endpoints of every axis between updates. Motion between updates is
+    // expected to be small, so endpoints are re-sorted with insertion sort
+    // and every swap of a lower and an upper endpoint is a candidate pair
+    // event.
+    template <typename T>
+    class Sweep {
+        static_assert(dimension::is_dimension<T>::value);
+        public:
+            Sweep() = default;
+
+            explicit Sweep(const std::vector<tridimensional::Box<T>>& boxes)
+                : boxes_(boxes)
+            {
+                for (std::size_t axis = 0; axis < 3; axis++) {
+                    std::vector<Endpoint>& es = endpoints_[axis];
+                    es.reserve(2 * boxes_.size());
+                    for (std::size_t i = 0; i < boxes_.size(); i++) {
+                        es.push_back(endpoint(i, axis, false));
+                        es.push_back(endpoint(i, axis, true));
+                    }
+                    std::sort(es.begin(), es.end(), [](const Endpoint& a, const Endpoint& b) { return a.key < b.key; });
+                }
+
+                std::vector<std::uint32_t> active;
+                for (const Endpoint& e : endpoints_[0]) {
+                    if (upper(e)) {
+                        active.erase(std::find(active.begin(), active.end(), e.box));
+                    } else {
+                        for (std::uint32_t j : active) {
+                            if (boxes_[e.box].overlaps(boxes_[j])) { pairs_.insert(key(e.box, j)); }
+                        }
+                        active.push_back(e.box);
+                    }
+                }
+            }
+
+            bool            empty() const   { return boxes_.empty(); }
+            std::size_t     size() const    { return boxes_.size(); }
+
+            // Moves every shape to its new box, appending the pairs that
+            // started and stopped overlapping since the last update. Returns
+            // false, changing nothing, unless boxes holds one box per shape
+            // the sweep was built over.
+            bool
+            update(
+                      const std::vector<tridimensional::Box<T>>& boxes
+                    , std::vector<Pair>& added
+                    , std::vector<Pair>& removed
+                    )
+            {
+                if (boxes.size() != boxes_.size()) { return false; }
+
+                boxes_ = boxes;
+                for (std::size_t axis = 0; axis < 3; axis++) {
+                    std::vector<Endpoint>& es = endpoints_[axis];
+                    for (Endpoint& e : es) { e = endpoint(e.box, axis, upper(e)); }
+
+                    for (std::size_t i = 1; i < es.size(); i++) {
+                        Endpoint e = es[i];
+                        std::size_t j = i;
+                        for (; j > 0 and e.key < es[j - 1].key; j--) {
+                            const Endpoint& f = es[j - 1];
+                            if (not upper(e) and upper(f)) {
+                                if (boxes_[e.box].overlaps(boxes_[f.box]) and pairs_.insert(key(e.box, f.box)).second) {
+                                    added.push_back(pair(e.box, f.box));
+                                }
+                            } else if (upper(e) and not upper(f)) {
+                                if (pairs_.erase(key(e.box, f.box)) > 0) {
+                                    removed.push_back(pair(e.box, f.box));
+                                }
+                            }
+                            es[j] = f;
+                        }
+                        es[j] = e;
+                    }
+                }
+                return true;
+            }
+
+            // Every pair of shapes whose boxes overlap, as (lower, higher)
+            // indices, in no particular order.
+            std::vector<Pair>
+            pairs() const {
+                std::vector<Pair> ps;
+                ps.reserve(pairs_.size());
+                for (std::uint64_t k : pairs_) {
+                    ps.push_back({static_cast<std::size_t>(k >> 32), static_cast<std::size_t>(k & 0xffffffff)});
+                }
+                return ps;
+            }
+        private:
+            // Keys order endpoints by coordinate, with lower endpoints ahead
+            // of upper endpoints at the same coordinate, so that boxes
+            // sharing a face overlap as closed intervals do.
+            struct Endpoint {
+                std::int64_t    key;
+                std::uint32_t   box;
+            };
+
+            static bool
+            upper(const Endpoint& e) {
+                return (e.key & 1) != 0;
+            }
+
+            static std::uint64_t
+            key(std::uint32_t i, std::uint32_t j) {
+                return i < j
+                    ? (std::uint64_t{i} << 32) | j
+                    : (std::uint64_t{j} << 32) | i
+                    ;
+            }
+
+            static Pair
+            pair(std::uint32_t i, std::uint32_t j) {
+                return i < j ? Pair{i, j} : Pair{j, i};
+            }
+
+            Endpoint
+            endpoint(std::size_t i, std::size_t axis, bool top) const {
+                const tridimensional::Point<T>& p = top ? boxes_[i].upper() : boxes_[i].lower();
+                std::int32_t value = static_cast<std::int32_t>(axis == 0 ? p.x() : axis == 1 ? p.y() : p.z());
+                return Endpoint{(std::int64_t{value} * 2) + (top ? 1 : 0), static_cast<std::uint32_t>(i)};
+            }
+
+            std::vector<tridimensional::Box<T>>     boxes_;
+            std::array<std::vector<Endpoint>, 3>    endpoints_;
+            std::unordered_set<std::uint64_t>       pairs_;
+    };
+} // namespace collision
+} // namespace paulista
+
+#endif // PAULISTA_SWEEP_HPP__
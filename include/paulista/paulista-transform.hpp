@@ -0,0 +1,201 @@
+#ifndef PAULISTA_TRANSFORM_HPP__
+#define PAULISTA_TRANSFORM_HPP__
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+
+#include "paulista-collision.hpp"
+#include "paulista-point.hpp"
+
+namespace paulista {
+namespace tridimensional {
+    // Rotation matrix in fixed point, every entry scaled by 2^30 and rounded.
+    class Rotation {
+        public:
+            static constexpr int            bits    = 30;
+            static constexpr std::int64_t   one     = std::int64_t{1} << bits;
+
+            using Matrix = std::array<std::array<std::int32_t, 3>, 3>;
+
+            Rotation() : m_{{{one, 0, 0}, {0, one, 0}, {0, 0, one}}} {}
+
+            explicit Rotation(const Matrix& m) : m_(m) {}
+
+            explicit Rotation(const std::array<std::array<double, 3>, 3>& m) : m_() {
+                for (std::size_t r = 0; r < 3; r++) {
+                    for (std::size_t c = 0; c < 3; c++) { m_[r][c] = fixed(m[r][c]); }
+                }
+            }
+
+            // Rotation of the quaternion w + xi + yj + zk, normalized first.
+            Rotation(double w, double x, double y, double z) : m_() {
+                double n = std::sqrt((w * w) + (x * x) + (y * y) + (z * z));
+                if (n == 0.0) { n = w = 1.0; }
+                w /= n;
+                x /= n;
+                y /= n;
+                z /= n;
+
+                m_ = {{
+                      {fixed(1 - (2 * ((y * y) + (z * z)))), fixed(2 * ((x * y) - (w * z))), fixed(2 * ((x * z) + (w * y)))}
+                    , {fixed(2 * ((x * y) + (w * z))), fixed(1 - (2 * ((x * x) + (z * z)))), fixed(2 * ((y * z) - (w * x)))}
+                    , {fixed(2 * ((x * z) - (w * y))), fixed(2 * ((y * z) + (w * x))), fixed(1 - (2 * ((x * x) + (y * y))))}
+                }};
+            }
+
+            bool operator==(const Rotation&) const = default;
+
+            const Matrix&
+            matrix() const {
+                return m_;
+            }
+
+            // R·p, rounded to the nearest unit.
+            template <typename T>
+            Point<T>
+            operator()(const Point<T>& p) const {
+                std::array<std::int64_t, 3> q = product(m_, p, false);
+                return Point<T>(round(q[0]), round(q[1]), round(q[2]));
+            }
+
+            // Direction of Rᵀ·v, kept at the largest scale whose components
+            // stay within +-2^30, which are the directions support expects.
+            template <typename T>
+            Vector<T>
+            inverse(const Vector<T>& v) const {
+                std::array<std::int64_t, 3> u = product(m_, v, true);
+
+                std::uint64_t m = 0;
+                for (std::int64_t c : u) { m = std::max(m, static_cast<std::uint64_t>(c < 0 ? -c : c)); }
+                int shift = m == 0 ? 0 : std::max(0, static_cast<int>(std::bit_width(m - 1)) - bits);
+
+                return Vector<T>(
+                          static_cast<std::int32_t>(u[0] >> shift)
+                        , static_cast<std::int32_t>(u[1] >> shift)
+                        , static_cast<std::int32_t>(u[2] >> shift)
+                        );
+            }
+        private:
+            static std::int32_t
+            fixed(double value) {
+                return static_cast<std::int32_t>(std::llround(std::clamp(value, -1.0, 1.0) * one));
+            }
+
+            static std::int32_t
+            round(std::int64_t value) {
+                return static_cast<std::int32_t>((value + (one / 2)) >> bits);
+            }
+
+            template <typename T>
+            static std::array<std::int64_t, 3>
+            product(const Matrix& m, const Point<T>& p, bool transposed) {
+                std::array<std::int64_t, 3> c = {
+                      static_cast<std::int32_t>(p.x())
+                    , static_cast<std::int32_t>(p.y())
+                    , static_cast<std::int32_t>(p.z())
+                    };
+                std::array<std::int64_t, 3> q = {};
+                for (std::size_t r = 0; r < 3; r++) {
+                    for (std::size_t k = 0; k < 3; k++) { q[r] += (transposed ? m[k][r] : m[r][k]) * c[k]; }
+                }
+                return q;
+            }
+
+            Matrix m_;
+    };
+} // namespace tridimensional
+
+namespace collision {
+    // Shape seen through a rotation followed by a translation, without
+    // copying its points. The view keeps a reference to the shape, which
+    // has to outlive it; moving a body only takes a new view.
+    template <SupportMappable S>
+    class Transformed {
+        public:
+            using value_type    = typename S::value_type;
+            using unit          = detail::unit_of<S>;
+
+            Transformed(
+                      const S& shape
+                    , const tridimensional::Rotation& rotation
+                    , const tridimensional::Vector<unit>& translation
+                    )
+                : shape_(&shape)
+                , rotation_(rotation)
+                , translation_(translation)
+            {}
+
+            Transformed(const S& shape, const tridimensional::Vector<unit>& translation)
+                : Transformed(shape, tridimensional::Rotation(), translation)
+            {}
+
+            value_type
+            operator[](std::size_t i) const requires requires (const S& s) { s[i]; } {
+                return rotation_((*shape_)[i]) + translation_;
+            }
+
+            bool            empty() const   { return detail::empty(*shape_); }
+            std::size_t     size() const    { return shape_->size(); }
+
+            const S&                                shape() const       { return *shape_; }
+            const tridimensional::Rotation&         rotation() const    { return rotation_; }
+            const tridimensional::Vector<unit>&     translation() const { return translation_; }
+        private:
+            const S*                        shape_;
+            tridimensional::Rotation        rotation_;
+            tridimensional::Vector<unit>    translation_;
+    };
+
+    // R·support(S, Rᵀ·v) + t. As the rotated points are rounded to the
+    // unit grid, the answer may fall short of the farthest transformed
+    // point along v by that rounding, under a unit per axis.
+    template <typename S, typename T>
+    inline std::optional<tridimensional::Point<T>>
+    support(const Transformed<S>& ts, const tridimensional::Vector<T>& v) {
+        std::optional<tridimensional::Point<T>> p = support(ts.shape(), ts.rotation().inverse(v));
+        if (not p) {
+            return std::nullopt;
+        } else {
+            return ts.rotation()(*p) + ts.translation();
+        }
+    }
+
+    // Rotates the directions back once and asks the shape for all of them,
+    // so a view over a point array still reads the points in one pass.
+    template <typename S, typename T>
+    inline bool
+    support_many(
+              const Transformed<S>& ts
+            , std::span<const tridimensional::Vector<T>> vs
+            , std::span<tridimensional::Point<T>> out
+            )
+    {
+        constexpr std::size_t group = tridimensional::cloud::detail::group;
+
+        if (detail::empty(ts)) {
+            return false;
+        } else {
+            std::size_t n = std::min(vs.size(), out.size());
+            for (std::size_t first = 0; first < n; first += group) {
+                std::size_t k = std::min(group, n - first);
+
+                std::array<tridimensional::Vector<T>, group> us;
+                for (std::size_t j = 0; j < k; j++) { us[j] = ts.rotation().inverse(vs[first + j]); }
+
+                std::span<tridimensional::Point<T>> ps = out.subspan(first, k);
+                support_many(ts.shape(), std::span<const tridimensional::Vector<T>>(us.data(), k), ps);
+                for (tridimensional::Point<T>& p : ps) { p = ts.rotation()(p) + ts.translation(); }
+            }
+            return true;
+        }
+    }
+} // namespace collision
+} // namespace paulista
+
+#endif // PAULISTA_TRANSFORM_HPP__
@@ -1,9 +1,28 @@
 #ifndef PAULISTA_HPP__
 #define PAULISTA_HPP__
 
-// #include "paulista-collision.hpp"
+#include "paulista-box.hpp"
+#include "paulista-bvh.hpp"
+#include "paulista-cache.hpp"
+#include "paulista-cloud.hpp"
+#include "paulista-collision.hpp"
 #include "paulista-dimension.hpp"
+#include "paulista-distance.hpp"
+#include "paulista-grid.hpp"
+#include "paulista-hull.hpp"
+#include "paulista-impact.hpp"
+#include "paulista-implicit.hpp"
+#include "paulista-import.hpp"
+#include "paulista-mapped.hpp"
+#include "paulista-memory.hpp"
+#include "paulista-moments.hpp"
+#include "paulista-parallel.hpp"
+#include "paulista-penetration.hpp"
 #include "paulista-point.hpp"
-// #include "paulista-simplex.hpp"
+#include "paulista-polytope.hpp"
+#include "paulista-simplex.hpp"
+#include "paulista-statistics.hpp"
+#include "paulista-sweep.hpp"
+#include "paulista-transform.hpp"
 
 #endif // PAULISTA_HPP__
@@ -0,0 +1,152 @@
+#include <gtest/gtest.h>
+#include <paulista/paulista.hpp>
+#include <rapidcheck/gtest.h>
+
+#include <algorithm>
+
+#include "fixtures.hpp"
+
+using Millimeter    = paulista::dimension::Millimeter;
+using Point         = paulista::tridimensional::Point<Millimeter>;
+using Box           = paulista::tridimensional::Box<Millimeter>;
+using Bvh           = paulista::collision::Bvh<Millimeter>;
+using Pair          = paulista::collision::Pair;
+
+namespace rc {
+    template<>
+    struct Arbitrary<Point> {
+        static Gen<Point>
+        arbitrary() {
+            return gen::construct<Point>(
+                      gen::inRange(-1000, 1000)
+                    , gen::inRange(-1000, 1000)
+                    , gen::inRange(-1000, 1000)
+                    );
+        }
+    };
+
+    template<>
+    struct Arbitrary<Box> {
+        static Gen<Box>
+        arbitrary() {
+            return gen::construct<Box>(
+                      gen::arbitrary<Point>()
+                    , gen::construct<Point>(
+                          gen::inRange(1000, 1200)
+                        , gen::inRange(1000, 1200)
+                        , gen::inRange(1000, 1200)
+                        )
+                    );
+        }
+    };
+}
+
+std::vector<Box>
+scatter(std::size_t n, std::int32_t size, std::uint64_t seed) {
+    std::vector<Box> boxes;
+    for (std::size_t i = 0; i < n; i++) {
+        auto next = [&seed]() {
+            seed = (seed * 6364136223846793005ull) + 1442695040888963407ull;
+            return static_cast<std::int32_t>((seed >> 33) % 20000) - 10000;
+        };
+        Point p(next(), next(), next());
+        boxes.emplace_back(p, p + Point(size, size / 2, size / 4));
+    }
+    return boxes;
+}
+
+TEST(BOX, OVERLAPS) {
+    Box unit(Point(0, 0, 0), Point(1, 1, 1));
+
+    EXPECT_TRUE(unit.overlaps(unit));
+    EXPECT_TRUE(unit.overlaps(Box(Point(1, 1, 1), Point(2, 2, 2))));
+    EXPECT_FALSE(unit.overlaps(Box(Point(2, 0, 0), Point(3, 1, 1))));
+    EXPECT_TRUE(unit.contains(Point(1, 0, 1)));
+    EXPECT_FALSE(unit.contains(Point(1, 0, 2)));
+    EXPECT_EQ(unit | Box(Point(-1, 2, 0)), Box(Point(-1, 0, 0), Point(1, 2, 1)));
+}
+
+TEST(BOX, BOUNDS) {
+    EXPECT_FALSE(paulista::tridimensional::box::bounds(std::vector<Point>{}));
+
+    std::vector<Point> ps = {{3, -1, 2}, {0, 4, -2}, {1, 1, 1}};
+    EXPECT_EQ(paulista::tridimensional::box::bounds(ps), Box(Point(0, -1, -2), Point(3, 4, 2)));
+}
+
+TEST(BVH, EMPTY) {
+    Bvh tree;
+    EXPECT_TRUE(tree.pairs().empty());
+    EXPECT_FALSE(tree.bounds());
+    EXPECT_FALSE(Bvh(std::vector<Box>{}).bounds());
+
+    std::size_t hits = 0;
+    tree.query(Box(Point(0, 0, 0)), [&hits](std::size_t) { hits++; });
+    EXPECT_EQ(hits, 0);
+}
+
+RC_GTEST_PROP(BVH, PAIRS, (const std::vector<Box>& boxes)) {
+    Bvh tree(boxes);
+
+    EXPECT_EQ(sorted(tree.pairs()), brute(boxes));
+}
+
+TEST(BVH, SCENE) {
+    std::vector<Box> boxes = scatter(2000, 600, 7);
+    Bvh tree(boxes);
+
+    EXPECT_LT(tree.nodes(), boxes.size());
+
+    Box all = boxes.front();
+    for (const Box& b : boxes) { all |= b; }
+    EXPECT_EQ(tree.bounds(), all);
+
+    EXPECT_EQ(sorted(tree.pairs()), brute(boxes));
+}
+
+TEST(BVH, REFIT) {
+    std::vector<Box> boxes = scatter(1000, 800, 11);
+    Bvh tree(boxes);
+
+    for (std::size_t i = 0; i < boxes.size(); i++) {
+        Point offset(static_cast<std::int32_t>(i % 7) * 40, -static_cast<std::int32_t>(i % 5) * 30, 25);
+        boxes[i] = Box(boxes[i].lower() + offset, boxes[i].upper() + offset);
+    }
+    ASSERT_TRUE(tree.refit(boxes));
+
+    EXPECT_EQ(sorted(tree.pairs()), brute(boxes));
+}
+
+TEST(BVH, REFIT_SIZE) {
+    std::vector<Box> boxes = scatter(100, 800, 13);
+    Bvh tree(boxes);
+    std::vector<Pair> before = tree.pairs();
+
+    std::vector<Box> fewer(boxes.begin(), boxes.begin() + 50);
+    EXPECT_FALSE(tree.refit(fewer));
+    boxes.push_back(boxes.front());
+    EXPECT_FALSE(tree.refit(boxes));
+    EXPECT_EQ(tree.pairs(), before);
+
+    boxes.pop_back();
+    EXPECT_TRUE(tree.refit(boxes));
+}
+
+RC_GTEST_PROP(BVH, QUERY, (const std::vector<Box>& boxes, const Box& b)) {
+    Bvh tree(boxes);
+
+    std::vector<std::size_t> hits;
+    tree.query(b, [&hits](std::size_t i) { hits.push_back(i); });
+    std::sort(hits.begin(), hits.end());
+
+    std::vector<std::size_t> expected;
+    for (std::size_t i = 0; i < boxes.size(); i++) {
+        if (boxes[i].overlaps(b)) { expected.push_back(i); }
+    }
+    EXPECT_EQ(hits, expected);
+}
+
+int
+main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
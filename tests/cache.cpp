@@ -0,0 +1,137 @@
+#define PAULISTA_STATISTICS
+
+#include <gtest/gtest.h>
+#include <paulista/paulista.hpp>
+#include <rapidcheck/gtest.h>
+
+#include <cmath>
+
+#include "fixtures.hpp"
+
+using Millimeter    = paulista::dimension::Millimeter;
+using Point         = paulista::tridimensional::Point<Millimeter>;
+using Shape         = paulista::collision::Shape<Millimeter>;
+using Cache         = paulista::collision::Cache<Millimeter>;
+using Statistics    = paulista::collision::Statistics;
+
+namespace statistics = paulista::collision::statistics;
+
+namespace rc {
+    template<>
+    struct Arbitrary<Point> {
+        static Gen<Point>
+        arbitrary() {
+            return gen::construct<Point>(
+                      gen::inRange(-1000, 1000)
+                    , gen::inRange(-1000, 1000)
+                    , gen::inRange(-1000, 1000)
+                    );
+        }
+    };
+}
+
+TEST(CACHE, SLOTS) {
+    Cache cache(100, 2);
+    EXPECT_EQ(cache.capacity(), 128);
+    EXPECT_EQ(cache.size(), 0);
+    EXPECT_FALSE(cache.axis(0, 0));
+
+    cache.store(0, 0, Point(1, 2, 3));
+    cache.store(1, 2, Point(4, 5, 6));
+    cache.store(1, 2, Point(7, 8, 9));
+    EXPECT_EQ(cache.size(), 2);
+    EXPECT_EQ(cache.axis(0, 0), Point(1, 2, 3));
+    EXPECT_EQ(cache.axis(1, 2), Point(7, 8, 9));
+    EXPECT_FALSE(cache.axis(2, 1));
+
+    cache.tick();
+    cache.tick();
+    cache.store(0, 0, Point(1, 1, 1));
+    EXPECT_EQ(cache.axis(1, 2), Point(7, 8, 9));
+
+    cache.tick();
+    EXPECT_FALSE(cache.axis(1, 2));
+    EXPECT_EQ(cache.axis(0, 0), Point(1, 1, 1));
+    EXPECT_EQ(cache.size(), 1);
+
+    cache.clear();
+    EXPECT_EQ(cache.size(), 0);
+}
+
+// With a single bucket, a new pair takes the slot of the one queried
+// least recently.
+TEST(CACHE, EVICTION) {
+    Cache cache(1);
+    ASSERT_EQ(cache.capacity(), Cache::ways);
+
+    for (std::uint32_t i = 0; i < Cache::ways; i++) {
+        cache.store(i, i, Point(i, 0, 0));
+        cache.tick();
+    }
+    cache.store(0, 0, Point(0, 1, 0));
+    cache.store(9, 9, Point(9, 0, 0));
+
+    EXPECT_EQ(cache.axis(0, 0), Point(0, 1, 0));
+    EXPECT_FALSE(cache.axis(1, 1));
+    EXPECT_EQ(cache.axis(9, 9), Point(9, 0, 0));
+}
+
+// A pair still apart along its cached direction takes one support point
+// per shape.
+TEST(CACHE, SEPARATED) {
+    Cache cache;
+    Shape xs = box(Point(0, 0, 0), 10, 10, 10);
+
+    ASSERT_EQ(paulista::collision::detect(xs, box(Point(100, 0, 0), 10, 10, 10), cache, 0, 1), false);
+    ASSERT_TRUE(cache.axis(0, 1));
+
+    for (std::int32_t step = 1; step <= 5; step++) {
+        cache.tick();
+        statistics::reset();
+        EXPECT_EQ(paulista::collision::detect(xs, box(Point(100 - step, step, 0), 10, 10, 10), cache, 0, 1), false);
+
+        Statistics s = statistics::collect();
+        EXPECT_EQ(s.queries, 1);
+        EXPECT_EQ(s.supports, 2);
+        EXPECT_EQ(s.iterations, 0);
+        EXPECT_EQ(s.early_outs, 1);
+    }
+
+    cache.tick();
+    EXPECT_EQ(paulista::collision::detect(xs, box(Point(5, 5, 5), 10, 10, 10), cache, 0, 1), true);
+    EXPECT_EQ(paulista::collision::detect(xs, box(Point(100, 0, 0), 10, 10, 10), cache, 0, 1), false);
+}
+
+TEST(CACHE, EMPTY) {
+    Cache cache;
+    EXPECT_FALSE(paulista::collision::detect(Shape(), box(Point(0, 0, 0), 10, 10, 10), cache, 0, 1));
+    EXPECT_FALSE(paulista::collision::distance(Shape(), box(Point(0, 0, 0), 10, 10, 10), cache, 0, 1));
+    EXPECT_EQ(cache.size(), 0);
+}
+
+// Pairs moving over a few frames get the answers of queries without a
+// cache.
+RC_GTEST_PROP(CACHE, FRAMES, (const Point& p, const Point& q, const Point& v)) {
+    Cache cache;
+    Point w(static_cast<std::int32_t>(v.x()) / 10, static_cast<std::int32_t>(v.y()) / 10, static_cast<std::int32_t>(v.z()) / 10);
+
+    for (std::int32_t frame = 0; frame < 4; frame++) {
+        Shape xs = box(p, 100, 200, 300);
+        Shape ys = box(q + (w * frame), 300, 200, 100);
+
+        RC_ASSERT(paulista::collision::detect(xs, ys, cache, 0, 1) == paulista::collision::detect(xs, ys));
+
+        std::optional<paulista::collision::Separation> expected = paulista::collision::distance(xs, ys);
+        std::optional<paulista::collision::Separation> actual = paulista::collision::distance(xs, ys, cache, 1, 0);
+        RC_ASSERT(actual.has_value() == expected.has_value());
+        if (actual) { RC_ASSERT(std::abs(actual->distance - expected->distance) < 1e-6); }
+
+        cache.tick();
+    }
+}
+
+int
+main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,176 @@
+#include <gtest/gtest.h>
+#include <paulista/paulista.hpp>
+#include <rapidcheck/gtest.h>
+
+#include <limits>
+
+using Millimeter    = paulista::dimension::Millimeter;
+using Point         = paulista::tridimensional::Point<Millimeter>;
+using PointCloud    = paulista::tridimensional::PointCloud<Millimeter>;
+using Shape         = paulista::collision::Shape<Millimeter>;
+
+namespace rc {
+    template<>
+    struct Arbitrary<Point> {
+        static Gen<Point>
+        arbitrary() {
+            return gen::construct<Point>(
+                      gen::inRange(-1000, 1000)
+                    , gen::inRange(-1000, 1000)
+                    , gen::inRange(-1000, 1000)
+                    );
+        }
+    };
+}
+
+TEST(CLOUD, EMPTY) {
+    PointCloud ps;
+    Point x(1, 0, 0);
+
+    EXPECT_TRUE(ps.empty());
+    EXPECT_EQ(ps.padded(), 0);
+    EXPECT_FALSE(paulista::tridimensional::cloud::extreme(ps, x));
+    EXPECT_FALSE(paulista::collision::support(ps, x));
+}
+
+RC_GTEST_PROP(CLOUD, LAYOUT, (const Shape& xs)) {
+    PointCloud ps(xs);
+
+    ASSERT_EQ(ps.size(), xs.size());
+    EXPECT_EQ(ps.padded() % 8, 0);
+    EXPECT_LT(ps.padded(), xs.size() + 8);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(ps.xs()) % 32, 0);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(ps.ys()) % 32, 0);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(ps.zs()) % 32, 0);
+
+    for (std::size_t i = 0; i < xs.size(); i++) {
+        EXPECT_EQ(ps[i], xs[i]);
+    }
+}
+
+RC_GTEST_PROP(CLOUD, SUPPORT, (const Shape& xs, const Point& v)) {
+    PointCloud ps(xs);
+    EXPECT_EQ(paulista::collision::support(ps, v), paulista::collision::support(xs, v));
+}
+
+TEST(CLOUD, KERNELS) {
+    namespace detail = paulista::tridimensional::cloud::detail;
+
+    std::vector<detail::Kernel> kernels = {detail::scalar};
+#if defined(__x86_64__) or defined(__i386__)
+    if (__builtin_cpu_supports("avx2"))     { kernels.push_back(detail::avx2); }
+    if (__builtin_cpu_supports("sse4.2"))   { kernels.push_back(detail::sse); }
+#endif
+
+    const std::int32_t far = 1 << 29;
+    Shape xs;
+    for (std::int32_t i = 0; i < 1000; i++) {
+        xs.emplace_back((i * 7919) % 1000, (i * 104729) % 1000, far - (i % 3));
+    }
+    PointCloud ps(xs);
+
+    std::vector<Point> directions = {
+          { 1,  0,  0}
+        , { 0,  1,  0}
+        , { 0,  0,  1}
+        , {-1, -1, -1}
+        , { far, far, far}
+        , {-far, 3, far}
+    };
+    for (const Point& v : directions) {
+        std::size_t expected = detail::scalar(
+                  ps.xs(), ps.ys(), ps.zs(), ps.padded()
+                , static_cast<std::int32_t>(v.x())
+                , static_cast<std::int32_t>(v.y())
+                , static_cast<std::int32_t>(v.z())
+                );
+        for (detail::Kernel kernel : kernels) {
+            std::size_t i = kernel(
+                      ps.xs(), ps.ys(), ps.zs(), ps.padded()
+                    , static_cast<std::int32_t>(v.x())
+                    , static_cast<std::int32_t>(v.y())
+                    , static_cast<std::int32_t>(v.z())
+                    );
+            EXPECT_EQ(i, expected);
+        }
+    }
+}
+
+TEST(CLOUD, MANY) {
+    namespace detail = paulista::tridimensional::cloud::detail;
+
+    std::vector<detail::Many> kernels = {detail::scalar_many};
+#if defined(__x86_64__) or defined(__i386__)
+    if (__builtin_cpu_supports("avx2"))     { kernels.push_back(detail::avx2_many); }
+#endif
+
+    const std::int32_t far = 1 << 29;
+    Shape xs;
+    for (std::int32_t i = 0; i < 1000; i++) {
+        xs.emplace_back((i * 7919) % 1000, (i * 104729) % 1000, far - (i % 3));
+    }
+    PointCloud ps(xs);
+
+    std::vector<std::int32_t> vx = {1, 0, 0, -1, far, -far, 0, -1, 1, 0, 0, 2, 3, -5, 7, far};
+    std::vector<std::int32_t> vy = {0, 1, 0, -1, far,    3, 0, 0, -1, 1, 0, 2, -3, 5, 7, -far};
+    std::vector<std::int32_t> vz = {0, 0, 1, -1, far,  far, -1, 0, 0, -1, 0, 2, 3, 5, -7, 1};
+    ASSERT_EQ(vx.size(), detail::group);
+
+    for (detail::Many kernel : kernels) {
+        for (std::size_t k : {std::size_t{1}, std::size_t{3}, std::size_t{6}, std::size_t{7}, detail::group}) {
+            std::vector<std::size_t> out(k);
+            kernel(ps.xs(), ps.ys(), ps.zs(), ps.padded(), vx.data(), vy.data(), vz.data(), k, out.data());
+            for (std::size_t j = 0; j < k; j++) {
+                EXPECT_EQ(out[j], detail::scalar(ps.xs(), ps.ys(), ps.zs(), ps.padded(), vx[j], vy[j], vz[j]));
+            }
+        }
+    }
+}
+
+TEST(CLOUD, WIDE) {
+    const std::int32_t top = std::numeric_limits<std::int32_t>::max();
+    const std::int32_t low = std::numeric_limits<std::int32_t>::min();
+
+    Shape xs;
+    for (std::int32_t i = 0; i < 100; i++) {
+        xs.emplace_back((i * 7919) % 1000, (i * 104729) % 1000, i % 3);
+    }
+    xs.emplace_back(top, top, top);
+    xs.emplace_back(low, low, low);
+    xs.emplace_back(top - 1, 0, low + 1);
+    PointCloud ps(xs);
+    EXPECT_EQ(ps.reach(), std::uint32_t{1} << 31);
+
+    std::vector<Point> vs = {
+          { 1,  0,  0}
+        , {-1, -1, -1}
+        , { top,  top,  top}
+        , { low,  low,  low}
+        , { 1 << 30, 1 << 30, 1 << 30}
+        , { top,  0,  low}
+        , { 1 << 30, 3, -(1 << 30)}
+    };
+    std::vector<std::size_t> out(vs.size());
+    ASSERT_TRUE(paulista::tridimensional::cloud::extremes(ps, std::span<const Point>(vs), std::span<std::size_t>(out)));
+    for (std::size_t j = 0; j < vs.size(); j++) {
+        std::optional<Point> expected = paulista::collision::support(xs, vs[j]);
+        EXPECT_EQ(paulista::collision::support(ps, vs[j]), expected);
+        EXPECT_EQ(ps[out[j]], *expected);
+    }
+}
+
+RC_GTEST_PROP(CLOUD, EXTREMES, (const Shape& xs, const std::vector<Point>& vs)) {
+    PointCloud ps(xs);
+    std::vector<std::size_t> out(vs.size());
+
+    RC_ASSERT(paulista::tridimensional::cloud::extremes(ps, std::span<const Point>(vs), std::span<std::size_t>(out)) == not xs.empty());
+    for (std::size_t j = 0; j < vs.size() and not xs.empty(); j++) {
+        RC_ASSERT(out[j] == *paulista::tridimensional::cloud::extreme(ps, vs[j]));
+    }
+}
+
+int
+main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -2,24 +2,73 @@
 #include <paulista/paulista.hpp>
 #include <rapidcheck/gtest.h>
 
+#include <algorithm>
+#include <cmath>
+
+#include "fixtures.hpp"
+
+using Millimeter    = paulista::dimension::Millimeter;
+using Point         = paulista::tridimensional::Point<Millimeter>;
+using Shape         = paulista::collision::Shape<Millimeter>;
+
+namespace rc {
+    template<>
+    struct Arbitrary<Point> {
+        static Gen<Point>
+        arbitrary() {
+            return gen::construct<Point>(
+                      gen::inRange(-1000, 1000)
+                    , gen::inRange(-1000, 1000)
+                    , gen::inRange(-1000, 1000)
+                    );
+        }
+    };
+}
+
+// Shape outside of paulista, known only by its support function.
+namespace user {
+    struct Corner {
+        using value_type = Point;
+
+        Point           origin;
+        std::int32_t    size;
+    };
+
+    std::optional<Point>
+    support(const Corner& c, const Point& v) {
+        std::array<Point, 4> ps = {
+              c.origin
+            , c.origin + Point(c.size, 0, 0)
+            , c.origin + Point(0, c.size, 0)
+            , c.origin + Point(0, 0, c.size)
+            };
+        return *std::max_element(ps.begin(), ps.end(), [&v](const Point& p, const Point& q) {
+            return paulista::tridimensional::point::dot(p, v) < paulista::tridimensional::point::dot(q, v);
+        });
+    }
+}
+
+template <typename X, typename Y>
+concept Detectable = requires (const X& xs, const Y& ys) { paulista::collision::detect(xs, ys); };
+
 TEST(SUPPORT, EMPTY) {
-    paulista::collision::Shape      ps;
-    paulista::tridimensional::Point x(1, 0, 0);
+    Shape ps;
+    Point x(1, 0, 0);
 
     ASSERT_FALSE(paulista::collision::support(ps, x));
 }
 
 TEST(SUPPORT, INCREASING) {
-    paulista::collision::Shape ps;
+    Shape ps;
     for (std::size_t i = 0; i < 100; i++) {
         ps.emplace_back(i, i, i);
     }
 
-    paulista::tridimensional::Point x(1, 0, 0);
-    paulista::tridimensional::Point y(0, 1, 0);
-    paulista::tridimensional::Point z(0, 0, 1);
+    Point x(1, 0, 0);
+    Point y(0, 1, 0);
+    Point z(0, 0, 1);
 
-    std::optional<paulista::tridimensional::Point> p = std::nullopt;
+    std::optional<Point> p = std::nullopt;
 
     p = paulista::collision::support(ps, x);
     ASSERT_TRUE(p);
@@ -34,15 +83,87 @@ TEST(SUPPORT, INCREASING) {
     EXPECT_EQ(p, ps.back());
 }
 
+// Directions of a 14-DOP: the axes and the diagonals, both ways.
+std::vector<Point>
+dop() {
+    std::vector<Point> vs;
+    for (std::int32_t s : {1, -1}) {
+        vs.emplace_back(s, 0, 0);
+        vs.emplace_back(0, s, 0);
+        vs.emplace_back(0, 0, s);
+        vs.emplace_back(s, s, s);
+        vs.emplace_back(-s, s, s);
+        vs.emplace_back(s, -s, s);
+        vs.emplace_back(s, s, -s);
+    }
+    return vs;
+}
+
+TEST(SUPPORT, EXTREMES) {
+    using Far = paulista::tridimensional::Point<paulista::dimension::Micrometer>;
+    constexpr std::int32_t highest = std::numeric_limits<std::int32_t>::max();
+    std::vector<Far> ps = {Far(0, 0, 0), Far(highest, highest, highest)};
+    Far v(highest, highest, highest);
+
+    std::optional<Far> p = paulista::collision::support(std::span<const Far>(ps), v);
+    ASSERT_TRUE(p);
+    EXPECT_EQ(*p, ps.back());
+
+    p = paulista::collision::support(std::span<const Far>(ps), -v);
+    ASSERT_TRUE(p);
+    EXPECT_EQ(*p, ps.front());
+}
+
+TEST(SUPPORT, MANY) {
+    Shape ps;
+    std::vector<Point> vs = dop();
+    std::vector<Point> out(vs.size(), Point(7, 7, 7));
+
+    EXPECT_FALSE(paulista::collision::support_many(ps, std::span<const Point>(vs), std::span<Point>(out)));
+    EXPECT_EQ(out, std::vector<Point>(vs.size(), Point(7, 7, 7)));
+
+    ps = box(Point(-10, -20, -30), 20, 40, 60);
+    ASSERT_TRUE(paulista::collision::support_many(ps, std::span<const Point>(vs).first(6), std::span<Point>(out)));
+    EXPECT_EQ(out[0], Point(10, -20, -30));
+    EXPECT_EQ(out[1], Point(-10, 20, -30));
+    EXPECT_EQ(out[2], Point(-10, -20, 30));
+    EXPECT_EQ(out[3], Point(10, 20, 30));
+    EXPECT_EQ(out[6], Point(7, 7, 7));
+}
+
+// Every shape answers each direction as its own support query would,
+// over more directions than one pass over the points follows.
+RC_GTEST_PROP(SUPPORT, DIRECTIONS, (const Shape& xs, const std::vector<Point>& extra, const Point& t)) {
+    RC_PRE(not xs.empty());
+
+    std::vector<Point> vs = dop();
+    vs.insert(vs.end(), extra.begin(), extra.end());
+
+    auto check = [&vs](const auto& s) {
+        using paulista::collision::support;
+
+        std::vector<Point> out(vs.size());
+        RC_ASSERT(paulista::collision::support_many(s, std::span<const Point>(vs), std::span<Point>(out)));
+        for (std::size_t j = 0; j < vs.size(); j++) { RC_ASSERT(out[j] == *support(s, vs[j])); }
+    };
+
+    paulista::tridimensional::PointCloud<Millimeter> cloud(xs);
+    check(xs);
+    check(cloud);
+    check(paulista::tridimensional::PointCloudView<Millimeter>(cloud));
+    check(paulista::collision::Transformed<Shape>(xs, paulista::tridimensional::Rotation(0.5, 0.5, -0.5, 0.5), t));
+    check(user::Corner{t, 300});
+}
+
 TEST(COLLISION, EMPTY) {
-    paulista::collision::Shape xs;
-    paulista::collision::Shape ys;
+    Shape xs;
+    Shape ys;
 
     ASSERT_FALSE(paulista::collision::detect(xs, ys));
 }
 
 TEST(COLLISION, POSITIVE) {
-    paulista::collision::Shape xs = {
+    Shape xs = {
           {0, 0, 0}
         , {2, 0, 0}
         , {2, 2, 0}
@@ -52,7 +173,7 @@ TEST(COLLISION, POSITIVE) {
         , {2, 2, 2}
         , {0, 2, 2}
     };
-    paulista::collision::Shape ys = {
+    Shape ys = {
           {1, 1, 1}
         , {3, 1, 1}
         , {3, 3, 1}
@@ -69,7 +190,7 @@ TEST(COLLISION, POSITIVE) {
 }
 
 TEST(COLLISION, NEGATIVE) {
-    paulista::collision::Shape xs = {
+    Shape xs = {
           {0, 0, 0}
         , {2, 0, 0}
         , {2, 2, 0}
@@ -79,7 +200,7 @@ TEST(COLLISION, NEGATIVE) {
         , {2, 2, 2}
         , {0, 2, 2}
     };
-    paulista::collision::Shape ys = {
+    Shape ys = {
           {3, 3, 3}
         , {5, 3, 3}
         , {5, 5, 3}
@@ -95,6 +216,187 @@ TEST(COLLISION, NEGATIVE) {
     EXPECT_FALSE(*collision);
 }
 
+TEST(COLLISION, TOUCHING) {
+    Shape xs = box(Point(0, 0, 0), 2, 2, 2);
+    Shape ys = box(Point(2, 0, 0), 2, 2, 2);
+    Shape zs = box(Point(2, 2, 2), 2, 2, 2);
+
+    EXPECT_EQ(paulista::collision::detect(xs, ys), true);
+    EXPECT_EQ(paulista::collision::detect(xs, zs), true);
+}
+
+TEST(COLLISION, DEGENERATE) {
+    Shape point     = {{1, 1, 1}};
+    Shape line      = {{0, 0, 0}, {2, 2, 2}};
+    Shape triangle  = {{1, 1, -1}, {1, -1, 3}, {-1, 3, 1}};
+    Shape missed    = {{5, 5, 5}};
+
+    EXPECT_EQ(paulista::collision::detect(point, point), true);
+    EXPECT_EQ(paulista::collision::detect(point, missed), false);
+    EXPECT_EQ(paulista::collision::detect(line, point), true);
+    EXPECT_EQ(paulista::collision::detect(line, missed), false);
+    EXPECT_EQ(paulista::collision::detect(line, triangle), true);
+    EXPECT_EQ(paulista::collision::detect(triangle, missed), false);
+}
+
+TEST(COLLISION, MICROMETER) {
+    using Micrometer = paulista::dimension::Micrometer;
+    using Far        = paulista::tridimensional::Point<Micrometer>;
+
+    std::int32_t far = 1 << 28;
+    paulista::collision::Shape<Micrometer> xs = {
+          {-far, -far, -far}
+        , { far, -far, -far}
+        , {-far,  far, -far}
+        , {-far, -far,  far}
+    };
+    paulista::collision::Shape<Micrometer> ys = {Far(far, far, far)};
+    paulista::collision::Shape<Micrometer> zs = {Far(-far + 1, -far + 1, -far + 1)};
+
+    EXPECT_EQ(paulista::collision::detect(xs, ys), false);
+    EXPECT_EQ(paulista::collision::detect(xs, zs), true);
+}
+
+// Boxes at opposite corners of the +-2^29 domain, whose Minkowski
+// difference reaches 2^30 along every axis.
+TEST(COLLISION, DOMAIN) {
+    using Micrometer = paulista::dimension::Micrometer;
+    using Far        = paulista::tridimensional::Point<Micrometer>;
+
+    std::int32_t edge = 1 << 29;
+    std::int32_t side = 1 << 20;
+    paulista::collision::Shape<Micrometer> xs = {
+          {-edge, -edge, -edge}
+        , {-edge + side, -edge, -edge}
+        , {-edge, -edge + side, -edge}
+        , {-edge, -edge, -edge + side}
+    };
+    paulista::collision::Shape<Micrometer> ys = {Far(edge, edge, edge), Far(edge - side, edge, edge)};
+    paulista::collision::Shape<Micrometer> zs = {Far(edge, edge, edge), Far(-edge, -edge, -edge)};
+
+    EXPECT_EQ(paulista::collision::detect(xs, ys), false);
+    EXPECT_EQ(paulista::collision::detect(xs, zs), true);
+    EXPECT_EQ(paulista::collision::detect(zs, xs), true);
+}
+
+RC_GTEST_PROP(COLLISION, SYMMETRIC, (const Point& p, const Point& q)) {
+    Shape xs = box(p, 300, 200, 100);
+    Shape ys = box(q, 100, 200, 300);
+
+    EXPECT_EQ(paulista::collision::detect(xs, ys), paulista::collision::detect(ys, xs));
+}
+
+RC_GTEST_PROP(COLLISION, BOXES, (const Point& p, const Point& q)) {
+    const std::int32_t width    = 300;
+    const std::int32_t height   = 200;
+    const std::int32_t depth    = 100;
+
+    Shape xs = box(p, width, height, depth);
+    Shape ys = box(q, width, height, depth);
+
+    auto overlap = [](Millimeter u, Millimeter v, std::int32_t size) {
+        Millimeter delta = (u > v) ? (u - v) : (v - u);
+        return delta <= Millimeter(size);
+    };
+    bool expected = overlap(p.x(), q.x(), width)
+                and overlap(p.y(), q.y(), height)
+                and overlap(p.z(), q.z(), depth)
+                ;
+    EXPECT_EQ(paulista::collision::detect(xs, ys), expected);
+}
+
+RC_GTEST_PROP(COLLISION, PMR, (const Point& p, const Point& q)) {
+    Shape xs = box(p, 100, 200, 300);
+    Shape ys = box(q, 300, 200, 100);
+
+    paulista::memory::Arena arena;
+    paulista::collision::pmr::Shape<Millimeter> us(xs.begin(), xs.end(), &arena);
+    paulista::collision::pmr::Shape<Millimeter> vs(ys.begin(), ys.end(), &arena);
+    RC_ASSERT(paulista::collision::detect(us, vs) == paulista::collision::detect(xs, ys));
+    RC_ASSERT(paulista::collision::support(us, q) == paulista::collision::support(xs, q));
+}
+
+TEST(COLLISION, MAPPABLE) {
+    using paulista::collision::SupportMappable;
+
+    static_assert(SupportMappable<Shape>);
+    static_assert(SupportMappable<paulista::collision::pmr::Shape<Millimeter>>);
+    static_assert(SupportMappable<paulista::tridimensional::PointCloud<Millimeter>>);
+    static_assert(SupportMappable<paulista::tridimensional::PointCloudView<Millimeter>>);
+    static_assert(SupportMappable<paulista::collision::Polytope<Millimeter>>);
+    static_assert(SupportMappable<paulista::collision::Sphere<Millimeter>>);
+    static_assert(SupportMappable<paulista::collision::Transformed<Shape>>);
+    static_assert(SupportMappable<paulista::collision::Sum<user::Corner, paulista::collision::Sphere<Millimeter>>>);
+    static_assert(SupportMappable<user::Corner>);
+    static_assert(not SupportMappable<int>);
+    static_assert(not SupportMappable<std::vector<int>>);
+    static_assert(not SupportMappable<Point>);
+
+    static_assert(Detectable<Shape, user::Corner>);
+    static_assert(not Detectable<Shape, paulista::collision::Shape<paulista::dimension::Micrometer>>);
+}
+
+RC_GTEST_PROP(COLLISION, FOREIGN, (const Point& p, const Point& q)) {
+    user::Corner c{p, 300};
+    Shape xs = {p, p + Point(300, 0, 0), p + Point(0, 300, 0), p + Point(0, 0, 300)};
+    Shape ys = box(q, 100, 200, 300);
+
+    RC_ASSERT(paulista::collision::detect(c, ys) == paulista::collision::detect(xs, ys));
+    RC_ASSERT(paulista::collision::detect(ys, c) == paulista::collision::detect(ys, xs));
+
+    std::optional<paulista::collision::Separation> expected = paulista::collision::distance(xs, ys);
+    std::optional<paulista::collision::Separation> actual = paulista::collision::distance(c, ys);
+    RC_ASSERT(actual.has_value() == expected.has_value());
+    if (actual) { RC_ASSERT(std::abs(actual->distance - expected->distance) < 1e-6); }
+
+    std::optional<paulista::collision::Contact> contact = paulista::collision::penetration(c, ys);
+    RC_ASSERT(contact.has_value() == paulista::collision::penetration(xs, ys).has_value());
+}
+
+TEST(COLLISION, BATCH) {
+    using Candidate = std::pair<const Shape*, const Shape*>;
+
+    std::vector<Shape> shapes;
+    for (std::int32_t i = 0; i < 200; i++) {
+        shapes.push_back(box(Point((i * 37) % 1000, (i * 91) % 1000, (i * 53) % 1000), 300, 200, 100));
+    }
+
+    std::vector<Candidate> pairs;
+    for (std::size_t i = 0; i < shapes.size(); i++) {
+        for (std::size_t j = i + 1; j < shapes.size(); j++) {
+            pairs.push_back({&shapes[i], &shapes[j]});
+        }
+    }
+
+    paulista::parallel::Pool pool(4);
+    std::vector<std::optional<bool>> results(pairs.size());
+    ASSERT_TRUE(paulista::collision::detect_batch(std::span<const Candidate>(pairs), std::span(results), pool));
+
+    for (std::size_t i = 0; i < pairs.size(); i++) {
+        EXPECT_EQ(results[i], paulista::collision::detect(*pairs[i].first, *pairs[i].second));
+    }
+
+    EXPECT_TRUE(paulista::collision::detect_batch(std::span<const Candidate>(), std::span(results).first(0), pool));
+}
+
+TEST(COLLISION, BATCH_SIZE) {
+    using Candidate = std::pair<const Shape*, const Shape*>;
+
+    Shape xs = box(Point(0, 0, 0), 300, 200, 100);
+    Shape ys = box(Point(100, 100, 100), 300, 200, 100);
+    std::vector<Candidate> pairs(10, Candidate{&xs, &ys});
+
+    paulista::parallel::Pool pool(4);
+    std::vector<std::optional<bool>> results(pairs.size() + 1);
+    EXPECT_FALSE(paulista::collision::detect_batch(std::span<const Candidate>(pairs), std::span(results).first(pairs.size() - 1), pool));
+    EXPECT_FALSE(paulista::collision::detect_batch(std::span<const Candidate>(pairs), std::span(results), pool));
+    for (const std::optional<bool>& r : results) { EXPECT_FALSE(r.has_value()); }
+
+    EXPECT_TRUE(paulista::collision::detect_batch(std::span<const Candidate>(pairs), std::span(results).first(pairs.size()), pool));
+    EXPECT_EQ(results[0], true);
+    EXPECT_FALSE(results.back().has_value());
+}
+
 int
 main(int argc, char** argv) {
     testing::InitGoogleTest(&argc, argv);
@@ -367,6 +367,26 @@ TEST(DIMENSION, TRAIT) {
     ASSERT_TRUE(paulista::dimension::is_dimension<const Micrometer&>::value);
 }
 
+TEST(DIMENSION, CONSTEXPR) {
+    static_assert(static_cast<std::int32_t>(Micrometer(Meter(2))) == 2000000);
+    static_assert(static_cast<std::int32_t>(Meter(Micrometer(2999999))) == 2);
+    static_assert(Millimeter(Centimeter(3)) + Millimeter(4) == Millimeter(34));
+
+    using Inch = paulista::dimension::Length<std::ratio<254, 10000>>;
+    static_assert(static_cast<std::int32_t>(Micrometer(Inch(3))) == 76200);
+    static_assert(static_cast<std::int32_t>(Inch(Millimeter(254))) == 10);
+    static_assert(paulista::dimension::is_dimension<const Inch&>::value);
+    static_assert(not paulista::dimension::is_dimension<std::int32_t>::value);
+}
+
+RC_GTEST_PROP(DIMENSION, TRUNCATION, (const Micrometer& x)) {
+    std::int32_t value = static_cast<std::int32_t>(x);
+
+    EXPECT_EQ(static_cast<std::int32_t>(Millimeter(x)), value / 1000);
+    EXPECT_EQ(static_cast<std::int32_t>(Meter(x)), value / 1000000);
+    EXPECT_EQ(Micrometer(Millimeter(x)), Micrometer(x - Micrometer(value % 1000)));
+}
+
 int
 main(int argc, char** argv) {
     testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+#include <paulista/paulista.hpp>
+#include <rapidcheck/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+
+#include "fixtures.hpp"
+
+using Millimeter    = paulista::dimension::Millimeter;
+using Point         = paulista::tridimensional::Point<Millimeter>;
+using Shape         = paulista::collision::Shape<Millimeter>;
+
+namespace rc {
+    template<>
+    struct Arbitrary<Point> {
+        static Gen<Point>
+        arbitrary() {
+            return gen::construct<Point>(
+                      gen::inRange(-1000, 1000)
+                    , gen::inRange(-1000, 1000)
+                    , gen::inRange(-1000, 1000)
+                    );
+        }
+    };
+}
+
+double
+coordinate(const Point& p, std::size_t axis) {
+    return static_cast<std::int32_t>(axis == 0 ? p.x() : axis == 1 ? p.y() : p.z());
+}
+
+void
+consistent(const paulista::collision::Separation& s) {
+    double dx = s.x[0] - s.y[0];
+    double dy = s.x[1] - s.y[1];
+    double dz = s.x[2] - s.y[2];
+    EXPECT_NEAR(std::sqrt((dx * dx) + (dy * dy) + (dz * dz)), s.distance, 1e-6);
+}
+
+TEST(DISTANCE, EMPTY) {
+    EXPECT_FALSE(paulista::collision::distance(Shape{}, box(Point(), 1, 1, 1)));
+    EXPECT_FALSE(paulista::collision::distance(box(Point(), 1, 1, 1), Shape{}));
+}
+
+TEST(DISTANCE, INTERSECTING) {
+    EXPECT_FALSE(paulista::collision::distance(box(Point(), 10, 10, 10), box(Point(5, 5, 5), 10, 10, 10)));
+    EXPECT_FALSE(paulista::collision::distance(box(Point(), 10, 10, 10), box(Point(10, 0, 0), 10, 10, 10)));
+}
+
+TEST(DISTANCE, BOXES) {
+    std::optional<paulista::collision::Separation> s = paulista::collision::distance(
+              box(Point(0, 0, 0), 10, 10, 10)
+            , box(Point(15, 20, 0), 10, 10, 10)
+            );
+
+    ASSERT_TRUE(s);
+    EXPECT_NEAR(s->distance, std::sqrt(125.0), 1e-9);
+    EXPECT_NEAR(s->x[0], 10.0, 1e-9);
+    EXPECT_NEAR(s->x[1], 10.0, 1e-9);
+    EXPECT_NEAR(s->y[0], 15.0, 1e-9);
+    EXPECT_NEAR(s->y[1], 20.0, 1e-9);
+    consistent(*s);
+}
+
+TEST(DISTANCE, TRIANGLE) {
+    Shape xs = {{0, 0, 0}, {100, 0, 0}, {0, 100, 0}};
+    Shape ys = {{20, 30, 7}};
+
+    std::optional<paulista::collision::Separation> s = paulista::collision::distance(xs, ys);
+    ASSERT_TRUE(s);
+    EXPECT_NEAR(s->distance, 7.0, 1e-9);
+    EXPECT_NEAR(s->x[0], 20.0, 1e-9);
+    EXPECT_NEAR(s->x[1], 30.0, 1e-9);
+    EXPECT_NEAR(s->x[2], 0.0, 1e-9);
+}
+
+RC_GTEST_PROP(DISTANCE, SYMMETRIC, (const Point& p, const Point& q)) {
+    std::optional<paulista::collision::Separation> s = paulista::collision::distance(box(p, 300, 200, 100), box(q, 100, 200, 300));
+    std::optional<paulista::collision::Separation> t = paulista::collision::distance(box(q, 100, 200, 300), box(p, 300, 200, 100));
+
+    ASSERT_EQ(s.has_value(), t.has_value());
+    if (s) { EXPECT_NEAR(s->distance, t->distance, 1e-6); }
+}
+
+RC_GTEST_PROP(DISTANCE, AXES, (const Point& p, const Point& q)) {
+    std::array<double, 3> sizes = {300, 200, 100};
+
+    double squared = 0.0;
+    for (std::size_t axis = 0; axis < 3; axis++) {
+        double gap = std::max(0.0, std::abs(coordinate(p, axis) - coordinate(q, axis)) - sizes[axis]);
+        squared += gap * gap;
+    }
+    RC_PRE(squared > 0.0);
+
+    std::optional<paulista::collision::Separation> s = paulista::collision::distance(box(p, 300, 200, 100), box(q, 300, 200, 100));
+    ASSERT_TRUE(s);
+    EXPECT_NEAR(s->distance, std::sqrt(squared), 1e-6);
+    consistent(*s);
+
+    for (std::size_t axis = 0; axis < 3; axis++) {
+        EXPECT_GE(s->x[axis], coordinate(p, axis) - 1e-6);
+        EXPECT_LE(s->x[axis], coordinate(p, axis) + sizes[axis] + 1e-6);
+        EXPECT_GE(s->y[axis], coordinate(q, axis) - 1e-6);
+        EXPECT_LE(s->y[axis], coordinate(q, axis) + sizes[axis] + 1e-6);
+    }
+}
+
+int
+main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,53 @@
+#ifndef PAULISTA_TESTS_FIXTURES_HPP__
+#define PAULISTA_TESTS_FIXTURES_HPP__
+
+#include <paulista/paulista.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Corners of the axis aligned box of the given extents with its lower
+// corner at p.
+inline paulista::collision::Shape<paulista::dimension::Millimeter>
+box(
+          const paulista::tridimensional::Point<paulista::dimension::Millimeter>& p
+        , std::int32_t width
+        , std::int32_t height
+        , std::int32_t depth
+        )
+{
+    using Point = paulista::tridimensional::Point<paulista::dimension::Millimeter>;
+
+    paulista::collision::Shape<paulista::dimension::Millimeter> ps;
+    for (std::int32_t i = 0; i < 2; i++) {
+        for (std::int32_t j = 0; j < 2; j++) {
+            for (std::int32_t k = 0; k < 2; k++) {
+                ps.push_back(p + Point(i * width, j * height, k * depth));
+            }
+        }
+    }
+    return ps;
+}
+
+// Every overlapping pair of boxes, as (lower, higher) indices in
+// lexicographic order, found by testing all of them.
+inline std::vector<paulista::collision::Pair>
+brute(const std::vector<paulista::tridimensional::Box<paulista::dimension::Millimeter>>& boxes) {
+    std::vector<paulista::collision::Pair> ps;
+    for (std::size_t i = 0; i < boxes.size(); i++) {
+        for (std::size_t j = i + 1; j < boxes.size(); j++) {
+            if (boxes[i].overlaps(boxes[j])) { ps.push_back({i, j}); }
+        }
+    }
+    return ps;
+}
+
+inline std::vector<paulista::collision::Pair>
+sorted(std::vector<paulista::collision::Pair> ps) {
+    std::sort(ps.begin(), ps.end());
+    return ps;
+}
+
+#endif // PAULISTA_TESTS_FIXTURES_HPP__
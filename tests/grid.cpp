@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+#include <paulista/paulista.hpp>
+#include <rapidcheck/gtest.h>
+
+#include <algorithm>
+
+#include "fixtures.hpp"
+
+using Millimeter    = paulista::dimension::Millimeter;
+using Point         = paulista::tridimensional::Point<Millimeter>;
+using Box           = paulista::tridimensional::Box<Millimeter>;
+using Grid          = paulista::collision::Grid<Millimeter>;
+using Pair          = paulista::collision::Pair;
+
+namespace rc {
+    template<>
+    struct Arbitrary<Point> {
+        static Gen<Point>
+        arbitrary() {
+            return gen::construct<Point>(
+                      gen::inRange(-1000, 1000)
+                    , gen::inRange(-1000, 1000)
+                    , gen::inRange(-1000, 1000)
+                    );
+        }
+    };
+
+    template<>
+    struct Arbitrary<Box> {
+        static Gen<Box>
+        arbitrary() {
+            return gen::construct<Box>(
+                      gen::arbitrary<Point>()
+                    , gen::construct<Point>(
+                          gen::inRange(1000, 1300)
+                        , gen::inRange(1000, 1300)
+                        , gen::inRange(1000, 1300)
+                        )
+                    );
+        }
+    };
+}
+
+TEST(GRID, EMPTY) {
+    Grid grid(Millimeter(100));
+    grid.insert({});
+
+    std::size_t hits = 0;
+    grid.query(Box(Point(0, 0, 0)), [&hits](std::size_t) { hits++; });
+    EXPECT_EQ(hits, 0);
+    EXPECT_TRUE(grid.pairs().empty());
+}
+
+TEST(GRID, NEGATIVE) {
+    Grid grid(Millimeter(10));
+    grid.insert({
+          Box(Point(-10, -10, -10), Point(-1, -1, -1))
+        , Box(Point(-1, -1, -1), Point(0, 0, 0))
+        , Box(Point(1, 1, 1), Point(9, 9, 9))
+    });
+
+    EXPECT_EQ(grid.pairs(), (std::vector<Pair>{{0, 1}}));
+}
+
+TEST(GRID, OVERSIZE) {
+    std::vector<Box> boxes = {Box(Point(-1000, -1000, 0), Point(1000, 1000, 10))};
+    for (int i = -990; i < 1000; i += 20) {
+        boxes.push_back(Box(Point(i, i, 5), Point(i + 10, i + 10, 15)));
+        boxes.push_back(Box(Point(i, -i, 20), Point(i + 10, -i + 10, 30)));
+    }
+
+    Grid grid(Millimeter(20));
+    grid.insert(boxes);
+
+    EXPECT_EQ(sorted(grid.pairs()), brute(boxes));
+}
+
+RC_GTEST_PROP(GRID, PAIRS, (const std::vector<Box>& boxes)) {
+    const auto cell = *rc::gen::inRange(100, 2500);
+
+    Grid grid{Millimeter(cell)};
+    grid.insert(boxes);
+
+    EXPECT_EQ(sorted(grid.pairs()), brute(boxes));
+}
+
+RC_GTEST_PROP(GRID, QUERY, (const std::vector<Box>& boxes, const Box& b)) {
+    Grid grid(Millimeter(250));
+    grid.insert(boxes);
+
+    std::vector<std::size_t> hits;
+    grid.query(b, [&hits](std::size_t i) { hits.push_back(i); });
+    std::sort(hits.begin(), hits.end());
+
+    std::vector<std::size_t> expected;
+    for (std::size_t i = 0; i < boxes.size(); i++) {
+        if (boxes[i].overlaps(b)) { expected.push_back(i); }
+    }
+    EXPECT_EQ(hits, expected);
+}
+
+int
+main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
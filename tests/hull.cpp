@@ -0,0 +1,184 @@
+#include <gtest/gtest.h>
+#include <paulista/paulista.hpp>
+#include <rapidcheck/gtest.h>
+
+#include <map>
+
+using Millimeter    = paulista::dimension::Millimeter;
+using Point         = paulista::tridimensional::Point<Millimeter>;
+using Shape         = paulista::collision::Shape<Millimeter>;
+using Hull          = paulista::collision::Hull<Millimeter>;
+
+namespace rc {
+    template<>
+    struct Arbitrary<Point> {
+        static Gen<Point>
+        arbitrary() {
+            return gen::construct<Point>(
+                      gen::inRange(-1000, 1000)
+                    , gen::inRange(-1000, 1000)
+                    , gen::inRange(-1000, 1000)
+                    );
+        }
+    };
+}
+
+std::int64_t
+dot(const Point& p, const Point& v) {
+    return  (std::int64_t{static_cast<std::int32_t>(p.x())} * static_cast<std::int32_t>(v.x()))
+        +   (std::int64_t{static_cast<std::int32_t>(p.y())} * static_cast<std::int32_t>(v.y()))
+        +   (std::int64_t{static_cast<std::int32_t>(p.z())} * static_cast<std::int32_t>(v.z()))
+        ;
+}
+
+void
+closed(const Hull& h) {
+    std::map<std::pair<std::size_t, std::size_t>, std::size_t> edges;
+    for (const paulista::collision::Face& f : h.faces) {
+        for (std::size_t i = 0; i < 3; i++) {
+            edges[{f[i], f[(i + 1) % 3]}]++;
+        }
+    }
+    for (const auto& [edge, count] : edges) {
+        EXPECT_EQ(count, 1);
+        EXPECT_EQ(edges.count({edge.second, edge.first}), 1);
+    }
+    EXPECT_EQ(h.vertices.size() + h.faces.size(), (edges.size() / 2) + 2);
+}
+
+void
+contains(const Hull& h, const Shape& ps) {
+    for (const paulista::collision::Face& f : h.faces) {
+        for (const Point& p : ps) {
+            EXPECT_LE(paulista::tridimensional::point::orient3d(h.vertices[f[0]], h.vertices[f[1]], h.vertices[f[2]], p), 0);
+        }
+    }
+}
+
+TEST(HULL, EMPTY) {
+    Hull h = paulista::collision::hull(Shape{});
+    EXPECT_TRUE(h.vertices.empty());
+    EXPECT_TRUE(h.faces.empty());
+}
+
+TEST(HULL, DEGENERATE) {
+    Hull point = paulista::collision::hull(Shape{{1, 2, 3}, {1, 2, 3}});
+    EXPECT_EQ(point.vertices.size(), 1);
+    EXPECT_EQ(point.faces.size(), 1);
+
+    Hull segment = paulista::collision::hull(Shape{{0, 0, 0}, {1, 1, 1}, {3, 3, 3}, {2, 2, 2}});
+    EXPECT_EQ(segment.vertices.size(), 2);
+    EXPECT_EQ(segment.faces.size(), 1);
+
+    Shape square;
+    for (std::int32_t i = 0; i <= 4; i++) {
+        for (std::int32_t j = 0; j <= 4; j++) {
+            square.emplace_back(i, j, i + j);
+        }
+    }
+    Hull planar = paulista::collision::hull(square);
+    EXPECT_EQ(planar.vertices.size(), 4);
+    EXPECT_EQ(planar.faces.size(), 2);
+}
+
+TEST(HULL, CUBE) {
+    Shape ps;
+    for (std::int32_t i = 0; i <= 10; i++) {
+        for (std::int32_t j = 0; j <= 10; j++) {
+            for (std::int32_t k = 0; k <= 10; k++) {
+                ps.emplace_back(i, j, k);
+            }
+        }
+    }
+    Hull h = paulista::collision::hull(ps);
+
+    EXPECT_EQ(h.vertices.size(), 8);
+    EXPECT_EQ(h.faces.size(), 12);
+    closed(h);
+    contains(h, ps);
+}
+
+TEST(HULL, EXTREME) {
+    Shape ps;
+    for (std::int32_t i = 0; i <= 6; i++) {
+        for (std::int32_t j = 0; j <= 6; j++) {
+            for (std::int32_t k = 0; k <= 6; k++) {
+                ps.emplace_back(i, j, k);
+            }
+        }
+    }
+
+    // Lattice orders that put points inside edges and faces ahead of the
+    // corners sharing their extreme coordinates.
+    std::uint64_t state = 7;
+    for (std::size_t round = 0; round < 20; round++) {
+        for (std::size_t i = ps.size() - 1; i > 0; i--) {
+            state = (state * 6364136223846793005ull) + 1442695040888963407ull;
+            std::swap(ps[i], ps[(state >> 33) % (i + 1)]);
+        }
+        for (std::size_t threads : {std::size_t{1}, std::size_t{4}}) {
+            Hull h = paulista::collision::hull(ps, threads);
+            EXPECT_EQ(h.vertices.size(), 8);
+            for (const Point& p : h.vertices) {
+                for (Millimeter c : {p.x(), p.y(), p.z()}) {
+                    EXPECT_TRUE(c == Millimeter(0) or c == Millimeter(6));
+                }
+            }
+            closed(h);
+            contains(h, ps);
+        }
+    }
+}
+
+RC_GTEST_PROP(HULL, RANDOM, (const std::vector<Point>& ps, const Point& v)) {
+    RC_PRE(ps.size() >= 4);
+
+    Hull h = paulista::collision::hull(ps);
+    contains(h, ps);
+    if (h.faces.size() > 1) { closed(h); }
+
+    std::optional<Point> expected = paulista::collision::support(ps, v);
+    std::optional<Point> reduced  = paulista::collision::support(h.vertices, v);
+    ASSERT_TRUE(reduced);
+    EXPECT_EQ(dot(*reduced, v), dot(*expected, v));
+
+    paulista::collision::Polytope<Millimeter> polytope(h.vertices, h.faces);
+    std::optional<Point> climbed = paulista::collision::support(polytope, v);
+    ASSERT_TRUE(climbed);
+    EXPECT_EQ(dot(*climbed, v), dot(*expected, v));
+}
+
+TEST(HULL, PARALLEL) {
+    Shape ps;
+    std::uint64_t state = 42;
+    for (std::size_t i = 0; i < 200000; i++) {
+        auto next = [&state]() {
+            state = (state * 6364136223846793005ull) + 1442695040888963407ull;
+            return static_cast<std::int32_t>((state >> 33) % 200001) - 100000;
+        };
+        ps.emplace_back(next(), next(), next());
+    }
+
+    Hull sequential = paulista::collision::hull(ps);
+    Hull parallel   = paulista::collision::hull(ps, 4);
+
+    EXPECT_EQ(sequential.vertices, parallel.vertices);
+    EXPECT_EQ(sequential.faces, parallel.faces);
+    closed(parallel);
+}
+
+RC_GTEST_PROP(HULL, ARENA, (const std::vector<Point>& ps)) {
+    paulista::memory::Arena arena(256);
+    paulista::collision::pmr::Shape<Millimeter> qs(ps.begin(), ps.end(), &arena);
+
+    Hull expected = paulista::collision::hull(ps);
+    Hull actual   = paulista::collision::hull(qs, 1, &arena);
+    EXPECT_EQ(actual.vertices, expected.vertices);
+    EXPECT_EQ(actual.faces, expected.faces);
+}
+
+int
+main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+#include <paulista/paulista.hpp>
+#include <rapidcheck/gtest.h>
+
+#include <algorithm>
+#include <limits>
+
+#include "fixtures.hpp"
+
+using Millimeter    = paulista::dimension::Millimeter;
+using Point         = paulista::tridimensional::Point<Millimeter>;
+using Vector        = paulista::tridimensional::Vector<Millimeter>;
+using Shape         = paulista::collision::Shape<Millimeter>;
+
+namespace rc {
+    template<>
+    struct Arbitrary<Point> {
+        static Gen<Point>
+        arbitrary() {
+            return gen::construct<Point>(
+                      gen::inRange(-1000, 1000)
+                    , gen::inRange(-1000, 1000)
+                    , gen::inRange(-1000, 1000)
+                    );
+        }
+    };
+}
+
+double
+coordinate(const Point& p, std::size_t axis) {
+    return static_cast<std::int32_t>(axis == 0 ? p.x() : axis == 1 ? p.y() : p.z());
+}
+
+TEST(IMPACT, EMPTY) {
+    EXPECT_FALSE(paulista::collision::impact(Shape{}, Vector(), box(Point(), 1, 1, 1), Vector()));
+    EXPECT_FALSE(paulista::collision::impact(box(Point(), 1, 1, 1), Vector(), Shape{}, Vector()));
+}
+
+TEST(IMPACT, OVERLAPPING) {
+    EXPECT_EQ(paulista::collision::impact(box(Point(), 10, 10, 10), Vector(5, 0, 0), box(Point(5, 5, 5), 10, 10, 10), Vector()), 0.0);
+}
+
+TEST(IMPACT, TUNNELING) {
+    Shape part    = box(Point(0, 0, 0), 10, 10, 10);
+    Shape fixture = box(Point(500, -100, -100), 2, 200, 200);
+
+    EXPECT_EQ(paulista::collision::detect(part, fixture), false);
+    EXPECT_EQ(paulista::collision::detect(box(Point(1000, 0, 0), 10, 10, 10), fixture), false);
+
+    std::optional<double> t = paulista::collision::impact(part, Vector(1000, 0, 0), fixture, Vector());
+    ASSERT_TRUE(t);
+    EXPECT_NEAR(*t, 0.49, 1e-9);
+
+    t = paulista::collision::impact(fixture, Vector(), part, Vector(1000, 0, 0));
+    ASSERT_TRUE(t);
+    EXPECT_NEAR(*t, 0.49, 1e-9);
+}
+
+TEST(IMPACT, MISS) {
+    Shape part    = box(Point(0, 0, 0), 10, 10, 10);
+    Shape fixture = box(Point(500, 20, 0), 2, 200, 200);
+
+    EXPECT_FALSE(paulista::collision::impact(part, Vector(1000, 0, 0), fixture, Vector()));
+    EXPECT_FALSE(paulista::collision::impact(part, Vector(400, 0, 0), box(Point(500, 0, 0), 2, 10, 10), Vector()));
+    EXPECT_FALSE(paulista::collision::impact(part, Vector(-1000, 0, 0), box(Point(500, 0, 0), 2, 10, 10), Vector()));
+}
+
+RC_GTEST_PROP(IMPACT, BOXES, (const Point& p, const Point& q, const Point& dx, const Point& dy)) {
+    std::array<double, 3> sizes = {300, 200, 100};
+
+    double enter = 0.0;
+    double leave = 1.0;
+    for (std::size_t axis = 0; axis < 3; axis++) {
+        double gap = coordinate(q, axis) - coordinate(p, axis);
+        double r   = coordinate(dx, axis) - coordinate(dy, axis);
+        if (r == 0.0) {
+            if (std::abs(gap) > sizes[axis]) { leave = -1.0; }
+        } else {
+            double a = (gap - sizes[axis]) / r;
+            double b = (gap + sizes[axis]) / r;
+            enter = std::max(enter, std::min(a, b));
+            leave = std::min(leave, std::max(a, b));
+        }
+    }
+
+    std::optional<double> t = paulista::collision::impact(box(p, 300, 200, 100), dx, box(q, 300, 200, 100), dy);
+    if (enter <= leave) {
+        ASSERT_TRUE(t);
+        EXPECT_NEAR(*t, enter, 1e-6);
+        EXPECT_LE(*t, enter + 1e-12);
+    } else if (t) {
+        EXPECT_LT(leave - enter, 1e-6);
+    }
+}
+
+int
+main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
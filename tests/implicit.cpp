@@ -0,0 +1,174 @@
+#include <gtest/gtest.h>
+#include <paulista/paulista.hpp>
+#include <rapidcheck/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+
+using Millimeter    = paulista::dimension::Millimeter;
+using Point         = paulista::tridimensional::Point<Millimeter>;
+using Shape         = paulista::collision::Shape<Millimeter>;
+using Sphere        = paulista::collision::Sphere<Millimeter>;
+using Cuboid        = paulista::collision::Cuboid<Millimeter>;
+using Capsule       = paulista::collision::Capsule<Millimeter>;
+using Cylinder      = paulista::collision::Cylinder<Millimeter>;
+
+namespace rc {
+    template<>
+    struct Arbitrary<Point> {
+        static Gen<Point>
+        arbitrary() {
+            return gen::construct<Point>(
+                      gen::inRange(-1000, 1000)
+                    , gen::inRange(-1000, 1000)
+                    , gen::inRange(-1000, 1000)
+                    );
+        }
+    };
+}
+
+double
+coordinate(const Point& p, std::size_t k) {
+    return static_cast<std::int32_t>(k == 0 ? p.x() : (k == 1 ? p.y() : p.z()));
+}
+
+double
+length(const Point& p) {
+    return std::sqrt(static_cast<double>(paulista::tridimensional::point::dot(p, p)));
+}
+
+// Distance from p to the segment from a to b.
+double
+segment(const Point& p, const Point& a, const Point& b) {
+    std::array<double, 3> d;
+    std::array<double, 3> w;
+    for (std::size_t k = 0; k < 3; k++) {
+        d[k] = coordinate(b, k) - coordinate(a, k);
+        w[k] = coordinate(p, k) - coordinate(a, k);
+    }
+    double dd = (d[0] * d[0]) + (d[1] * d[1]) + (d[2] * d[2]);
+    double t  = dd == 0.0 ? 0.0 : std::clamp(((w[0] * d[0]) + (w[1] * d[1]) + (w[2] * d[2])) / dd, 0.0, 1.0);
+
+    double squared = 0.0;
+    for (std::size_t k = 0; k < 3; k++) { squared += (w[k] - (t * d[k])) * (w[k] - (t * d[k])); }
+    return std::sqrt(squared);
+}
+
+TEST(IMPLICIT, SPHERE) {
+    Sphere s{Point(10, 20, 30), Millimeter(100)};
+    EXPECT_EQ(paulista::collision::support(s, Point(1, 0, 0)), Point(110, 20, 30));
+    EXPECT_EQ(paulista::collision::support(s, Point(0, -5, 0)), Point(10, -80, 30));
+    EXPECT_EQ(paulista::collision::support(s, Point(1, 1, 0)), Point(81, 91, 30));
+}
+
+RC_GTEST_PROP(IMPLICIT, SPHERES, (const Point& p, const Point& q, std::uint16_t r, std::uint16_t s)) {
+    Sphere x{p, Millimeter(r % 500)};
+    Sphere y{q, Millimeter(s % 500)};
+
+    double gap = length(p - q) - (r % 500) - (s % 500);
+    RC_PRE(std::abs(gap) > 2.0);
+    RC_ASSERT(*paulista::collision::detect(x, y) == (gap < 0.0));
+}
+
+TEST(IMPLICIT, QUERIES) {
+    Sphere x{Point(0, 0, 0), Millimeter(50)};
+
+    std::optional<paulista::collision::Contact> c = paulista::collision::penetration(x, Sphere{Point(80, 0, 0), Millimeter(50)});
+    ASSERT_TRUE(c);
+    EXPECT_NEAR(c->depth, 20.0, 1.0);
+    EXPECT_GT(c->normal[0], 0.95);
+
+    std::optional<double> t = paulista::collision::impact(x, Point(300, 0, 0), Sphere{Point(300, 0, 0), Millimeter(50)}, Point(0, 0, 0));
+    ASSERT_TRUE(t);
+    EXPECT_NEAR(*t, 2.0 / 3.0, 1e-3);
+}
+
+RC_GTEST_PROP(IMPLICIT, CUBOID, (const Point& p, const Point& q, const Point& v)) {
+    Point lower(std::min(p.x(), q.x()), std::min(p.y(), q.y()), std::min(p.z(), q.z()));
+    Point upper(std::max(p.x(), q.x()), std::max(p.y(), q.y()), std::max(p.z(), q.z()));
+    Cuboid c{lower, upper};
+
+    Shape corners;
+    for (std::size_t i = 0; i < 8; i++) {
+        corners.emplace_back((i & 1) ? upper.x() : lower.x(), (i & 2) ? upper.y() : lower.y(), (i & 4) ? upper.z() : lower.z());
+    }
+    RC_ASSERT(paulista::tridimensional::point::dot(*paulista::collision::support(c, v), v)
+            == paulista::tridimensional::point::dot(*paulista::collision::support(corners, v), v));
+
+    Shape other = {v, v + Point(50, 0, 0), v + Point(0, 50, 0), v + Point(0, 0, 50)};
+    RC_ASSERT(paulista::collision::detect(c, other) == paulista::collision::detect(corners, other));
+}
+
+RC_GTEST_PROP(IMPLICIT, CAPSULE, (const Point& a, const Point& b, const Point& p)) {
+    Capsule c{a, b, Millimeter(100)};
+    Sphere s{p, Millimeter(50)};
+
+    double gap = segment(p, a, b) - 150.0;
+    RC_PRE(std::abs(gap) > 2.0);
+    RC_ASSERT(*paulista::collision::detect(c, s) == (gap < 0.0));
+}
+
+TEST(IMPLICIT, CYLINDER) {
+    Cylinder c{Point(0, 0, 0), Point(0, 0, 100), Millimeter(10)};
+
+    EXPECT_EQ(paulista::collision::support(c, Point(1, 0, 1)), Point(10, 0, 100));
+    EXPECT_EQ(paulista::collision::support(c, Point(0, -1, -1)), Point(0, -10, 0));
+    EXPECT_EQ(paulista::collision::support(c, Point(0, 0, 1))->z(), 100);
+
+    EXPECT_EQ(paulista::collision::detect(c, Sphere{Point(15, 0, 50), Millimeter(4)}), false);
+    EXPECT_EQ(paulista::collision::detect(c, Sphere{Point(15, 0, 50), Millimeter(6)}), true);
+    EXPECT_EQ(paulista::collision::detect(c, Sphere{Point(8, 8, 105), Millimeter(4)}), false);
+    EXPECT_EQ(paulista::collision::detect(c, Sphere{Point(5, 5, 105), Millimeter(6)}), true);
+}
+
+// A rounded box is a box grown by a sphere, and sits at the distance of
+// the box less the radius.
+TEST(IMPLICIT, SUM) {
+    paulista::collision::Sum rounded{Cuboid{Point(0, 0, 0), Point(100, 100, 100)}, Sphere{Point(0, 0, 0), Millimeter(10)}};
+
+    EXPECT_EQ(paulista::collision::support(rounded, Point(1, 0, 0))->x(), 110);
+    EXPECT_EQ(paulista::collision::support(rounded, Point(-1, -1, -1)), Point(-6, -6, -6));
+
+    std::optional<paulista::collision::Separation> s = paulista::collision::distance(rounded, Sphere{Point(300, 50, 50), Millimeter(40)});
+    ASSERT_TRUE(s);
+    EXPECT_NEAR(s->distance, 150.0, 1.0);
+    EXPECT_NEAR(s->x[0], 110.0, 1.0);
+    EXPECT_NEAR(s->y[0], 260.0, 1.0);
+
+    EXPECT_FALSE(paulista::collision::distance(rounded, Sphere{Point(140, 50, 50), Millimeter(40)}));
+    EXPECT_EQ(paulista::collision::detect(rounded, Sphere{Point(140, 50, 50), Millimeter(40)}), true);
+}
+
+TEST(IMPLICIT, UNION) {
+    paulista::collision::Union pair{Sphere{Point(0, 0, 0), Millimeter(10)}, Sphere{Point(100, 0, 0), Millimeter(10)}};
+
+    EXPECT_EQ(paulista::collision::support(pair, Point(1, 0, 0)), Point(110, 0, 0));
+    EXPECT_EQ(paulista::collision::support(pair, Point(-1, 0, 0)), Point(-10, 0, 0));
+    EXPECT_EQ(paulista::collision::detect(pair, Sphere{Point(50, 15, 0), Millimeter(10)}), true);
+    EXPECT_EQ(paulista::collision::detect(pair, Sphere{Point(50, 25, 0), Millimeter(10)}), false);
+}
+
+TEST(IMPLICIT, SCALED) {
+    paulista::collision::Scaled ellipsoid{Sphere{Point(0, 0, 0), Millimeter(100)}, {2.0, 1.0, 0.5}};
+
+    EXPECT_EQ(paulista::collision::support(ellipsoid, Point(1, 0, 0)), Point(200, 0, 0));
+    EXPECT_EQ(paulista::collision::support(ellipsoid, Point(0, 1, 0)), Point(0, 100, 0));
+    EXPECT_EQ(paulista::collision::support(ellipsoid, Point(0, 0, -1)), Point(0, 0, -50));
+    EXPECT_EQ(paulista::collision::detect(ellipsoid, Cuboid{Point(190, -5, -5), Point(220, 5, 5)}), true);
+    EXPECT_EQ(paulista::collision::detect(ellipsoid, Cuboid{Point(-5, -5, 60), Point(5, 5, 80)}), false);
+}
+
+TEST(IMPLICIT, TRANSFORMED) {
+    Cuboid c{Point(-10, -50, -10), Point(10, 50, 10)};
+    double h = std::sqrt(0.5);
+    paulista::collision::Transformed<Cuboid> turned(c, paulista::tridimensional::Rotation(h, 0.0, 0.0, h), Point(100, 0, 0));
+
+    EXPECT_EQ(paulista::collision::detect(turned, Sphere{Point(160, 0, 0), Millimeter(15)}), true);
+    EXPECT_EQ(paulista::collision::detect(turned, Sphere{Point(100, 40, 0), Millimeter(15)}), false);
+}
+
+int
+main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,252 @@
+#include <gtest/gtest.h>
+#include <paulista/paulista.hpp>
+#include <rapidcheck/gtest.h>
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <set>
+#include <sstream>
+#include <string>
+#include <tuple>
+
+using Millimeter    = paulista::dimension::Millimeter;
+using Micrometer    = paulista::dimension::Micrometer;
+using Point         = paulista::tridimensional::Point<Millimeter>;
+using Shape         = paulista::collision::Shape<Millimeter>;
+
+namespace rc {
+    template<>
+    struct Arbitrary<Point> {
+        static Gen<Point>
+        arbitrary() {
+            return gen::construct<Point>(
+                      gen::inRange(-1000, 1000)
+                    , gen::inRange(-1000, 1000)
+                    , gen::inRange(-1000, 1000)
+                    );
+        }
+    };
+}
+
+std::string
+temporary(const std::string& name, const std::string& contents) {
+    std::string path = (std::filesystem::temp_directory_path() / ("paulista-" + name)).string();
+    std::ofstream(path, std::ios::binary) << contents;
+    return path;
+}
+
+using Key = std::tuple<std::int32_t, std::int32_t, std::int32_t>;
+
+Key
+key(const Point& p) {
+    return {static_cast<std::int32_t>(p.x()), static_cast<std::int32_t>(p.y()), static_cast<std::int32_t>(p.z())};
+}
+
+// Collects emitted shapes, checking that none of them repeats a point.
+struct Collect {
+    std::vector<Shape> shapes;
+
+    void
+    operator()(Shape&& s) {
+        std::set<Key> seen;
+        for (const Point& p : s) { EXPECT_TRUE(seen.insert(key(p)).second); }
+        shapes.push_back(std::move(s));
+    }
+
+    std::set<Key>
+    points() const {
+        std::set<Key> all;
+        for (const Shape& s : shapes) {
+            for (const Point& p : s) { all.insert(key(p)); }
+        }
+        return all;
+    }
+};
+
+template <typename U>
+void
+put(std::string& out, U value, bool big = false) {
+    char bytes[sizeof(U)];
+    std::memcpy(bytes, &value, sizeof(U));
+    if (big != (std::endian::native == std::endian::big)) { std::reverse(bytes, bytes + sizeof(U)); }
+    out.append(bytes, sizeof(U));
+}
+
+TEST(IMPORT, MISSING) {
+    Collect c;
+    EXPECT_FALSE(paulista::io::stl<Millimeter>("/nonexistent/paulista.stl", c));
+    EXPECT_FALSE(paulista::io::ply<Millimeter>("/nonexistent/paulista.ply", c));
+    EXPECT_FALSE(paulista::io::obj<Millimeter>("/nonexistent/paulista.obj", c));
+    EXPECT_TRUE(c.shapes.empty());
+}
+
+TEST(IMPORT, STL) {
+    std::string data(80, ' ');
+    put<std::uint32_t>(data, 2);
+    for (float offset : {0.0f, 1.0f}) {
+        for (std::size_t i = 0; i < 3; i++) { put<float>(data, 0.0f); }
+        for (std::size_t v = 0; v < 3; v++) {
+            put<float>(data, offset);
+            put<float>(data, v == 1 ? 0.003f : 0.0f);
+            put<float>(data, v == 2 ? 0.003f : 0.0f);
+        }
+        put<std::uint16_t>(data, 0);
+    }
+    std::string path = temporary("stl", data);
+
+    Collect c;
+    paulista::io::Options options;
+    options.scale = 1000.0;
+    EXPECT_EQ(paulista::io::stl<Millimeter>(path, c, options), 6);
+    EXPECT_EQ(c.points(), (std::set<Key>{{0, 0, 0}, {0, 3, 0}, {0, 0, 3}, {1000, 0, 0}, {1000, 3, 0}, {1000, 0, 3}}));
+
+    std::size_t shapes = 0;
+    auto fine = [&shapes](paulista::collision::Shape<Micrometer>&&) { shapes++; };
+    options.scale = 1000000.0;
+    EXPECT_EQ(paulista::io::stl<Micrometer>(path, fine, options), 6);
+    EXPECT_EQ(shapes, 1);
+
+    std::filesystem::resize_file(path, data.size() - 1);
+    EXPECT_FALSE(paulista::io::stl<Millimeter>(path, c, options));
+    std::filesystem::remove(path);
+}
+
+TEST(IMPORT, PLY_ASCII) {
+    std::string path = temporary("ascii.ply",
+        "ply\r\n"
+        "format ascii 1.0\r\n"
+        "comment exported\r\n"
+        "element vertex 4\r\n"
+        "property float y\r\n"
+        "property list uchar int ignored\r\n"
+        "property float x\r\n"
+        "property float z\r\n"
+        "element face 1\r\n"
+        "property list uchar int vertex_indices\r\n"
+        "end_header\r\n"
+        "1.5 2 7 7 -2 +3\r\n"
+        "0 0 0 0 0\r\n"
+        "1.5   1 9   -2 3e0\r\n"
+        "4 0 4 1e-1 1\r\n"
+        "3 0 1 2\r\n"
+        );
+
+    Collect c;
+    EXPECT_EQ(paulista::io::ply<Millimeter>(path, c), 3);
+    EXPECT_EQ(c.points(), (std::set<Key>{{-2, 2, 3}, {0, 0, 0}, {4, 4, 0}}));
+    std::filesystem::remove(path);
+}
+
+TEST(IMPORT, PLY_BINARY) {
+    for (bool big : {false, true}) {
+        std::string data = std::string("ply\nformat ") + (big ? "binary_big_endian" : "binary_little_endian") + " 1.0\n"
+            "element camera 1\n"
+            "property list uchar short angles\n"
+            "property double focal\n"
+            "element vertex 3\n"
+            "property double x\n"
+            "property uchar red\n"
+            "property int y\n"
+            "property float z\n"
+            "end_header\n";
+        put<std::uint8_t>(data, 2, big);
+        put<std::int16_t>(data, -1, big);
+        put<std::int16_t>(data, 1, big);
+        put<double>(data, 35.0, big);
+        for (std::int32_t i = 0; i < 3; i++) {
+            put<double>(data, i * 0.5, big);
+            put<std::uint8_t>(data, 255, big);
+            put<std::int32_t>(data, -i, big);
+            put<float>(data, 2.0f, big);
+        }
+        std::string path = temporary("binary.ply", data);
+
+        Collect c;
+        paulista::io::Options options;
+        options.scale = 10.0;
+        EXPECT_EQ(paulista::io::ply<Millimeter>(path, c, options), 3);
+        EXPECT_EQ(c.points(), (std::set<Key>{{0, 0, 20}, {5, -10, 20}, {10, -20, 20}}));
+
+        std::filesystem::resize_file(path, data.size() - 1);
+        EXPECT_FALSE(paulista::io::ply<Millimeter>(path, c, options));
+        std::filesystem::remove(path);
+    }
+}
+
+TEST(IMPORT, OBJ) {
+    std::string path = temporary("obj",
+        "# cube corner\n"
+        "v 0 0 0\n"
+        "vn 0 0 1\n"
+        "vt 0.5 0.5\n"
+        "v 1 0 0 1.0\r\n"
+        "\n"
+        "v\t0 1 0\n"
+        "v 0 0 0\n"
+        "f 1 2 3\n"
+        "v 0 0 1"
+        );
+
+    Collect c;
+    EXPECT_EQ(paulista::io::obj<Millimeter>(path, c), 4);
+    EXPECT_EQ(c.points(), (std::set<Key>{{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {0, 0, 1}}));
+
+    std::string bad = temporary("bad.obj", "v 0 0 0\nv 1 x 0\n");
+    EXPECT_FALSE(paulista::io::obj<Millimeter>(bad, c));
+
+    std::string far = temporary("far.obj", "v 0 0 3000000\n");
+    paulista::io::Options options;
+    options.scale = 1000.0;
+    EXPECT_FALSE(paulista::io::obj<Millimeter>(far, c, options));
+
+    std::filesystem::remove(path);
+    std::filesystem::remove(bad);
+    std::filesystem::remove(far);
+}
+
+RC_GTEST_PROP(IMPORT, CHUNKS, (const Shape& xs, std::uint8_t chunk, std::uint8_t block)) {
+    RC_PRE(not xs.empty());
+
+    std::ostringstream text;
+    auto meters = [&text](const Point& p) {
+        text    << "v "
+                << static_cast<std::int32_t>(p.x()) * 0.001 << " "
+                << static_cast<std::int32_t>(p.y()) * 0.001 << " "
+                << static_cast<std::int32_t>(p.z()) * 0.001 << "\n";
+    };
+    for (const Point& p : xs) {
+        meters(p);
+        meters(xs.front());
+    }
+    std::string path = temporary("chunks.obj", text.str());
+
+    paulista::io::Options options;
+    options.scale = 1000.0;
+    options.chunk = 1 + (chunk % 8);
+    options.block = 1 + block;
+
+    Collect c;
+    std::optional<std::size_t> total = paulista::io::obj<Millimeter>(path, c, options);
+    ASSERT_TRUE(total);
+
+    std::size_t emitted = 0;
+    for (std::size_t i = 0; i < c.shapes.size(); i++) {
+        emitted += c.shapes[i].size();
+        if (i + 1 < c.shapes.size()) { EXPECT_EQ(c.shapes[i].size(), options.chunk); }
+    }
+    EXPECT_EQ(*total, emitted);
+
+    std::set<Key> expected;
+    for (const Point& p : xs) { expected.insert(key(p)); }
+    EXPECT_EQ(c.points(), expected);
+    std::filesystem::remove(path);
+}
+
+int
+main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
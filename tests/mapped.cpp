@@ -0,0 +1,170 @@
+#include <gtest/gtest.h>
+#include <paulista/paulista.hpp>
+#include <rapidcheck/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <string>
+
+using Millimeter    = paulista::dimension::Millimeter;
+using Micrometer    = paulista::dimension::Micrometer;
+using Point         = paulista::tridimensional::Point<Millimeter>;
+using Shape         = paulista::collision::Shape<Millimeter>;
+using Layout        = paulista::io::Layout;
+
+namespace rc {
+    template<>
+    struct Arbitrary<Point> {
+        static Gen<Point>
+        arbitrary() {
+            return gen::construct<Point>(
+                      gen::inRange(-1000, 1000)
+                    , gen::inRange(-1000, 1000)
+                    , gen::inRange(-1000, 1000)
+                    );
+        }
+    };
+}
+
+std::string
+temporary(const std::string& name) {
+    return (std::filesystem::temp_directory_path() / ("paulista-" + name)).string();
+}
+
+TEST(MAPPED, MISSING) {
+    EXPECT_FALSE(paulista::io::map<Millimeter>(temporary("missing")));
+}
+
+TEST(MAPPED, EMPTY) {
+    std::string path = temporary("empty");
+    for (Layout layout : {Layout::aos, Layout::soa}) {
+        ASSERT_TRUE(paulista::io::save(path, Shape{}, layout));
+
+        std::optional<paulista::io::Mapped<Millimeter>> m = paulista::io::map<Millimeter>(path);
+        ASSERT_TRUE(m);
+        EXPECT_TRUE(m->empty());
+        EXPECT_TRUE(m->points().empty());
+        EXPECT_TRUE(m->cloud().empty());
+        EXPECT_FALSE(paulista::collision::support(m->points(), Point(1, 0, 0)));
+    }
+    std::filesystem::remove(path);
+}
+
+RC_GTEST_PROP(MAPPED, ROUNDTRIP, (const Shape& xs, const Point& v)) {
+    RC_PRE(not xs.empty());
+
+    std::string path = temporary("roundtrip");
+    ASSERT_TRUE(paulista::io::save(path, xs, Layout::aos));
+    std::optional<paulista::io::Mapped<Millimeter>> aos = paulista::io::map<Millimeter>(path);
+    ASSERT_TRUE(aos);
+    EXPECT_EQ(aos->layout(), Layout::aos);
+    EXPECT_EQ(aos->bounds(), *paulista::tridimensional::box::bounds(xs));
+    EXPECT_TRUE(aos->cloud().empty());
+    EXPECT_TRUE(std::equal(xs.begin(), xs.end(), aos->points().begin(), aos->points().end()));
+    EXPECT_EQ(paulista::collision::support(aos->points(), v), paulista::collision::support(xs, v));
+
+    std::string other = temporary("roundtrip-soa");
+    ASSERT_TRUE(paulista::io::save(other, xs, Layout::soa));
+    std::optional<paulista::io::Mapped<Millimeter>> soa = paulista::io::map<Millimeter>(other);
+    ASSERT_TRUE(soa);
+    EXPECT_EQ(soa->layout(), Layout::soa);
+    EXPECT_EQ(soa->bounds(), *paulista::tridimensional::box::bounds(xs));
+    EXPECT_TRUE(soa->points().empty());
+    EXPECT_EQ(soa->cloud().size(), xs.size());
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(soa->cloud().zs()) % 32, 0);
+    for (std::size_t i = 0; i < xs.size(); i++) { EXPECT_EQ(soa->cloud()[i], xs[i]); }
+    EXPECT_EQ(paulista::collision::support(soa->cloud(), v), paulista::collision::support(xs, v));
+
+    Shape ys = {v, v + Point(1, 1, 1)};
+    EXPECT_EQ(paulista::collision::detect(aos->points(), ys), paulista::collision::detect(xs, ys));
+    EXPECT_EQ(paulista::collision::detect(soa->cloud(), ys), paulista::collision::detect(xs, ys));
+
+    std::filesystem::remove(path);
+    std::filesystem::remove(other);
+}
+
+TEST(MAPPED, WIDE) {
+    const std::int32_t top = std::numeric_limits<std::int32_t>::max();
+
+    std::string path = temporary("wide");
+    Shape xs = {Point(0, 0, 0), Point(top, top, top), Point(-top, 5, top)};
+    ASSERT_TRUE(paulista::io::save(path, xs, Layout::soa));
+    std::optional<paulista::io::Mapped<Millimeter>> m = paulista::io::map<Millimeter>(path);
+    ASSERT_TRUE(m);
+    EXPECT_EQ(m->cloud().reach(), std::uint32_t{1} << 31);
+
+    for (const Point& v : {Point(top, top, top), Point(-top, top, top), Point(1, 1, 1)}) {
+        EXPECT_EQ(paulista::collision::support(m->cloud(), v), paulista::collision::support(xs, v));
+    }
+
+    // Bounds the points do not respect must not change the answers.
+    {
+        std::fstream f(path, std::ios::binary | std::ios::in | std::ios::out);
+        f.seekp(offsetof(paulista::io::Header, lower));
+        std::array<std::int32_t, 6> zeros = {};
+        f.write(reinterpret_cast<const char*>(zeros.data()), sizeof(zeros));
+    }
+    m = paulista::io::map<Millimeter>(path);
+    ASSERT_TRUE(m);
+    for (const Point& v : {Point(top, top, top), Point(-top, top, top), Point(1, 1, 1)}) {
+        EXPECT_EQ(paulista::collision::support(m->cloud(), v), paulista::collision::support(xs, v));
+    }
+    std::filesystem::remove(path);
+}
+
+TEST(MAPPED, UNIT) {
+    std::string path = temporary("unit");
+    ASSERT_TRUE(paulista::io::save(path, Shape{Point(1, 2, 3)}));
+    EXPECT_TRUE(paulista::io::map<Millimeter>(path));
+    EXPECT_FALSE(paulista::io::map<Micrometer>(path));
+    std::filesystem::remove(path);
+}
+
+TEST(MAPPED, CORRUPT) {
+    std::string path = temporary("corrupt");
+    Shape xs(100, Point(1, 2, 3));
+    ASSERT_TRUE(paulista::io::save(path, xs, Layout::aos));
+
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 1);
+    EXPECT_FALSE(paulista::io::map<Millimeter>(path));
+
+    ASSERT_TRUE(paulista::io::save(path, xs, Layout::aos));
+    {
+        std::fstream f(path, std::ios::binary | std::ios::in | std::ios::out);
+        f.seekp(8);
+        std::uint32_t version = 2;
+        f.write(reinterpret_cast<const char*>(&version), sizeof(version));
+    }
+    EXPECT_FALSE(paulista::io::map<Millimeter>(path));
+
+    std::filesystem::resize_file(path, 10);
+    EXPECT_FALSE(paulista::io::map<Millimeter>(path));
+    std::filesystem::remove(path);
+}
+
+TEST(MAPPED, PADDING) {
+    std::string path = temporary("padding");
+    ASSERT_TRUE(paulista::io::save(path, Shape{Point(-5, -5, -5)}, Layout::soa));
+    ASSERT_TRUE(paulista::io::map<Millimeter>(path));
+
+    for (std::size_t k = 0; k < 3; k++) {
+        ASSERT_TRUE(paulista::io::save(path, Shape{Point(-5, -5, -5)}, Layout::soa));
+        {
+            std::fstream f(path, std::ios::binary | std::ios::in | std::ios::out);
+            f.seekp(sizeof(paulista::io::Header) + (((8 * k) + 7) * sizeof(std::int32_t)));
+            std::int32_t zero = 0;
+            f.write(reinterpret_cast<const char*>(&zero), sizeof(zero));
+        }
+        EXPECT_FALSE(paulista::io::map<Millimeter>(path));
+    }
+    std::filesystem::remove(path);
+}
+
+int
+main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+#include <paulista/paulista.hpp>
+#include <rapidcheck/gtest.h>
+
+#include <cstdint>
+#include <memory_resource>
+#include <thread>
+#include <vector>
+
+using Arena = paulista::memory::Arena;
+
+// Upstream resource counting the calls that reach it.
+struct Upstream : public std::pmr::memory_resource {
+    std::size_t allocations     = 0;
+    std::size_t deallocations   = 0;
+
+    void*
+    do_allocate(std::size_t n, std::size_t a) override {
+        allocations++;
+        return std::pmr::new_delete_resource()->allocate(n, a);
+    }
+
+    void
+    do_deallocate(void* p, std::size_t n, std::size_t a) override {
+        deallocations++;
+        std::pmr::new_delete_resource()->deallocate(p, n, a);
+    }
+
+    bool
+    do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+
+TEST(ARENA, BLOCK) {
+    Upstream upstream;
+    {
+        Arena arena(4096, &upstream);
+        EXPECT_EQ(upstream.allocations, 1);
+
+        std::pmr::vector<std::int32_t> vs(&arena);
+        vs.reserve(512);
+        for (std::int32_t i = 0; i < 512; i++) { vs.push_back(i); }
+        EXPECT_EQ(upstream.allocations, 1);
+        EXPECT_EQ(arena.overflow(), 0);
+    }
+    EXPECT_EQ(upstream.deallocations, upstream.allocations);
+}
+
+TEST(ARENA, ALIGNMENT) {
+    Arena arena(1024);
+    for (std::size_t a : {1, 2, 8, 16, 32, 64}) {
+        EXPECT_NE(arena.allocate(3, 1), nullptr);
+        void* p = arena.allocate(24, a);
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(p) % a, 0);
+    }
+}
+
+// Whatever overflowed the block during one round is folded into it on
+// reset, so the same round again allocates nothing upstream.
+RC_GTEST_PROP(ARENA, GROWS, (const std::vector<std::uint16_t>& sizes)) {
+    Upstream upstream;
+    Arena arena(64, &upstream);
+
+    auto round = [&arena, &sizes]() {
+        for (std::uint16_t n : sizes) { RC_ASSERT(arena.allocate(n + 1, 8) != nullptr); }
+    };
+
+    round();
+    std::size_t overflow = arena.overflow();
+    std::size_t capacity = arena.capacity();
+    arena.reset();
+    RC_ASSERT(arena.overflow() == 0);
+    RC_ASSERT(arena.capacity() >= capacity + overflow);
+
+    std::size_t allocations = upstream.allocations;
+    round();
+    RC_ASSERT(upstream.allocations == allocations);
+    RC_ASSERT(arena.overflow() == 0);
+
+    arena.reset();
+    RC_ASSERT(upstream.allocations == allocations);
+}
+
+// A round past the limit grows the block only up to it, and the rest is
+// handed back upstream on every reset.
+TEST(ARENA, LIMIT) {
+    Upstream upstream;
+    {
+        Arena arena(64, &upstream, 4096);
+        for (std::size_t round = 0; round < 3; round++) {
+            for (std::size_t i = 0; i < 100; i++) { EXPECT_NE(arena.allocate(1000, 8), nullptr); }
+            EXPECT_GT(arena.overflow(), 0);
+            arena.reset();
+            EXPECT_EQ(arena.capacity(), 4096);
+            EXPECT_EQ(upstream.allocations - upstream.deallocations, 1);
+        }
+    }
+    EXPECT_EQ(upstream.deallocations, upstream.allocations);
+}
+
+TEST(ARENA, TICK) {
+    void* first = paulista::memory::local().allocate(16, 16);
+    void* second = paulista::memory::local().allocate(16, 16);
+    EXPECT_NE(first, second);
+
+    paulista::memory::tick();
+    EXPECT_EQ(paulista::memory::local().allocate(16, 16), first);
+}
+
+TEST(ARENA, THREADS) {
+    Arena* main = &paulista::memory::local();
+
+    std::vector<Arena*> arenas(4, nullptr);
+    {
+        std::vector<std::jthread> workers;
+        for (std::size_t i = 0; i < arenas.size(); i++) {
+            workers.emplace_back([&arenas, i]() {
+                arenas[i] = &paulista::memory::local();
+                std::pmr::vector<std::size_t> vs(100000, i, arenas[i]);
+            });
+        }
+    }
+    for (std::size_t i = 0; i < arenas.size(); i++) {
+        EXPECT_NE(arenas[i], main);
+        for (std::size_t j = i + 1; j < arenas.size(); j++) { EXPECT_NE(arenas[i], arenas[j]); }
+    }
+}
+
+int
+main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
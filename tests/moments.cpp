@@ -0,0 +1,159 @@
+#include <gtest/gtest.h>
+#include <paulista/paulista.hpp>
+#include <rapidcheck/gtest.h>
+
+#include <cmath>
+#include <limits>
+#include <random>
+
+using Millimeter    = paulista::dimension::Millimeter;
+using Micrometer    = paulista::dimension::Micrometer;
+using Point         = paulista::tridimensional::Point<Millimeter>;
+using PointCloud    = paulista::tridimensional::PointCloud<Millimeter>;
+using Moments       = paulista::tridimensional::Moments<Millimeter>;
+
+namespace rc {
+    template<>
+    struct Arbitrary<Point> {
+        static Gen<Point>
+        arbitrary() {
+            return gen::construct<Point>(
+                      gen::inRange(-1000, 1000)
+                    , gen::inRange(-1000, 1000)
+                    , gen::inRange(-1000, 1000)
+                    );
+        }
+    };
+}
+
+double
+coordinate(const Point& p, std::size_t k) {
+    return static_cast<std::int32_t>(k == 0 ? p.x() : (k == 1 ? p.y() : p.z()));
+}
+
+TEST(MOMENTS, EMPTY) {
+    EXPECT_FALSE(paulista::tridimensional::moments::reduce(std::vector<Point>{}));
+    EXPECT_FALSE(paulista::tridimensional::moments::reduce(PointCloud()));
+}
+
+RC_GTEST_PROP(MOMENTS, PASSES, (const std::vector<Point>& ps)) {
+    RC_PRE(not ps.empty());
+
+    std::optional<Moments> m = paulista::tridimensional::moments::reduce(ps);
+    ASSERT_TRUE(m);
+    EXPECT_EQ(m->count, ps.size());
+    EXPECT_EQ(m->centroid, *paulista::tridimensional::point::centroid(ps));
+    EXPECT_EQ(m->bounds, *paulista::tridimensional::box::bounds(ps));
+
+    std::array<double, 3> mean = {};
+    for (const Point& p : ps) {
+        for (std::size_t k = 0; k < 3; k++) { mean[k] += coordinate(p, k) / ps.size(); }
+    }
+    for (std::size_t a = 0; a < 3; a++) {
+        for (std::size_t b = 0; b < 3; b++) {
+            double expected = 0.0;
+            for (const Point& p : ps) { expected += (coordinate(p, a) - mean[a]) * (coordinate(p, b) - mean[b]); }
+            EXPECT_NEAR(m->covariance[a][b], expected / ps.size(), 1e-6 * (1.0 + std::abs(expected)));
+        }
+    }
+}
+
+RC_GTEST_PROP(MOMENTS, CLOUD, (const std::vector<Point>& ps)) {
+    RC_PRE(not ps.empty());
+
+    std::optional<Moments> expected = paulista::tridimensional::moments::reduce(ps);
+    std::optional<Moments> actual = paulista::tridimensional::moments::reduce(PointCloud(ps));
+    ASSERT_TRUE(actual);
+    EXPECT_EQ(actual->count, expected->count);
+    EXPECT_EQ(actual->centroid, expected->centroid);
+    EXPECT_EQ(actual->bounds, expected->bounds);
+    EXPECT_EQ(actual->covariance, expected->covariance);
+}
+
+// Far apart clusters at the ends of the coordinate range overflow any
+// 64-bit sum of squares, and cancel out in the centroid.
+TEST(MOMENTS, WIDE) {
+    using Far = paulista::tridimensional::Point<Micrometer>;
+    constexpr std::int32_t limit = std::numeric_limits<std::int32_t>::max();
+
+    std::vector<Far> ps;
+    for (std::int32_t i = 0; i < 100000; i++) {
+        ps.emplace_back(limit - (i % 7), -limit + (i % 5), i);
+        ps.emplace_back(-limit + (i % 7), limit - (i % 5), -i);
+    }
+
+    paulista::parallel::Pool pool(4);
+    std::optional<paulista::tridimensional::Moments<Micrometer>> m = paulista::tridimensional::moments::reduce(ps, pool);
+    ASSERT_TRUE(m);
+    EXPECT_EQ(m->count, ps.size());
+    EXPECT_EQ(m->centroid, Far(0, 0, 0));
+    EXPECT_EQ(m->bounds, paulista::tridimensional::Box<Micrometer>(Far(-limit, -limit, -99999), Far(limit, limit, 99999)));
+
+    std::array<long double, 3> mean = {};
+    for (const Far& p : ps) {
+        mean[0] += static_cast<std::int32_t>(p.x());
+        mean[1] += static_cast<std::int32_t>(p.y());
+        mean[2] += static_cast<std::int32_t>(p.z());
+    }
+    for (long double& c : mean) { c /= ps.size(); }
+
+    long double xx = 0.0;
+    long double xy = 0.0;
+    for (const Far& p : ps) {
+        long double dx = static_cast<std::int32_t>(p.x()) - mean[0];
+        long double dy = static_cast<std::int32_t>(p.y()) - mean[1];
+        xx += dx * dx;
+        xy += dx * dy;
+    }
+    EXPECT_NEAR(m->covariance[0][0], static_cast<double>(xx / ps.size()), 1e-9 * m->covariance[0][0]);
+    EXPECT_NEAR(m->covariance[0][1], static_cast<double>(xy / ps.size()), 1e-9 * m->covariance[0][0]);
+    EXPECT_GT(m->covariance[0][0], 4.0e18);
+}
+
+TEST(MOMENTS, KERNELS) {
+    namespace detail = paulista::tridimensional::moments::detail;
+
+    std::vector<detail::Kernel> kernels = {detail::scalar};
+#if defined(__x86_64__) or defined(__i386__)
+    if (__builtin_cpu_supports("avx2")) { kernels.push_back(detail::avx2); }
+#endif
+
+    std::mt19937 engine(7);
+    std::vector<std::int32_t> cs(3 * 4099);
+    for (std::int32_t& c : cs) { c = static_cast<std::int32_t>(engine()); }
+    cs[0] = std::numeric_limits<std::int32_t>::min();
+    cs[1] = std::numeric_limits<std::int32_t>::max();
+
+    std::size_t n = cs.size() / 3;
+    std::vector<std::int32_t> xs(n);
+    std::vector<std::int32_t> ys(n);
+    std::vector<std::int32_t> zs(n);
+    for (std::size_t i = 0; i < n; i++) {
+        xs[i] = cs[3 * i];
+        ys[i] = cs[(3 * i) + 1];
+        zs[i] = cs[(3 * i) + 2];
+    }
+
+    detail::Sums expected;
+    detail::scalar(cs.data(), cs.data() + 1, cs.data() + 2, 3, n, expected);
+    for (detail::Kernel k : kernels) {
+        detail::Sums interleaved;
+        detail::Sums split;
+        k(cs.data(), cs.data() + 1, cs.data() + 2, 3, n, interleaved);
+        k(xs.data(), ys.data(), zs.data(), 1, n, split);
+
+        for (const detail::Sums& s : {interleaved, split}) {
+            EXPECT_EQ(s.count, expected.count);
+            EXPECT_EQ(s.lower, expected.lower);
+            EXPECT_EQ(s.upper, expected.upper);
+            EXPECT_EQ(s.first, expected.first);
+            EXPECT_TRUE(s.second == expected.second);
+        }
+    }
+}
+
+int
+main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
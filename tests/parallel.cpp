@@ -0,0 +1,46 @@
+#include <gtest/gtest.h>
+#include <paulista/paulista.hpp>
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+TEST(PARALLEL, RUN) {
+    paulista::parallel::Pool pool(4);
+
+    std::vector<std::atomic<int>> calls(1000);
+    pool.run(calls.size(), [&calls](std::size_t i) { calls[i]++; });
+    for (const std::atomic<int>& c : calls) { EXPECT_EQ(c.load(), 1); }
+}
+
+TEST(PARALLEL, NESTED) {
+    paulista::parallel::Pool pool(4);
+
+    std::atomic<std::size_t> total = 0;
+    pool.run(16, [&pool, &total](std::size_t) {
+        pool.run(16, [&total](std::size_t) { total++; });
+    });
+    EXPECT_EQ(total.load(), 256);
+}
+
+TEST(PARALLEL, THROW) {
+    paulista::parallel::Pool pool(4);
+
+    for (std::size_t thrower : {std::size_t{0}, std::size_t{1}, std::size_t{999}}) {
+        EXPECT_THROW(
+            pool.run(1000, [thrower](std::size_t i) {
+                if (i == thrower) { throw std::runtime_error("task"); }
+            }),
+            std::runtime_error);
+    }
+
+    std::atomic<std::size_t> total = 0;
+    pool.run(100, [&total](std::size_t) { total++; });
+    EXPECT_EQ(total.load(), 100);
+}
+
+int
+main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
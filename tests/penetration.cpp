@@ -0,0 +1,151 @@
+#include <gtest/gtest.h>
+#include <paulista/paulista.hpp>
+#include <rapidcheck/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+
+#include "fixtures.hpp"
+
+using Millimeter    = paulista::dimension::Millimeter;
+using Point         = paulista::tridimensional::Point<Millimeter>;
+using Shape         = paulista::collision::Shape<Millimeter>;
+
+namespace rc {
+    template<>
+    struct Arbitrary<Point> {
+        static Gen<Point>
+        arbitrary() {
+            return gen::construct<Point>(
+                      gen::inRange(-1000, 1000)
+                    , gen::inRange(-1000, 1000)
+                    , gen::inRange(-1000, 1000)
+                    );
+        }
+    };
+}
+
+double
+coordinate(const Point& p, std::size_t axis) {
+    return static_cast<std::int32_t>(axis == 0 ? p.x() : axis == 1 ? p.y() : p.z());
+}
+
+// Distance from the origin to the nearest face plane of the hull of the
+// Minkowski difference.
+double
+expected(const Shape& xs, const Shape& ys) {
+    Shape ds;
+    for (const Point& x : xs) {
+        for (const Point& y : ys) { ds.push_back(x - y); }
+    }
+    paulista::collision::Hull<Millimeter> h = paulista::collision::hull(ds);
+
+    double best = std::numeric_limits<double>::max();
+    for (const paulista::collision::Face& f : h.faces) {
+        std::array<std::array<double, 3>, 3> vs;
+        for (std::size_t i = 0; i < 3; i++) {
+            for (std::size_t axis = 0; axis < 3; axis++) { vs[i][axis] = coordinate(h.vertices[f[i]], axis); }
+        }
+        std::array<double, 3> u = {vs[1][0] - vs[0][0], vs[1][1] - vs[0][1], vs[1][2] - vs[0][2]};
+        std::array<double, 3> v = {vs[2][0] - vs[0][0], vs[2][1] - vs[0][1], vs[2][2] - vs[0][2]};
+        std::array<double, 3> n = {
+              (u[1] * v[2]) - (u[2] * v[1])
+            , (u[2] * v[0]) - (u[0] * v[2])
+            , (u[0] * v[1]) - (u[1] * v[0])
+        };
+        double length = std::sqrt((n[0] * n[0]) + (n[1] * n[1]) + (n[2] * n[2]));
+        if (length == 0.0) { continue; }
+
+        best = std::min(best, std::abs((n[0] * vs[0][0]) + (n[1] * vs[0][1]) + (n[2] * vs[0][2])) / length);
+    }
+    return best;
+}
+
+void
+consistent(const paulista::collision::Contact& c) {
+    double length = std::sqrt((c.normal[0] * c.normal[0]) + (c.normal[1] * c.normal[1]) + (c.normal[2] * c.normal[2]));
+    EXPECT_NEAR(length, 1.0, 1e-9);
+    for (std::size_t axis = 0; axis < 3; axis++) {
+        EXPECT_NEAR(c.x[axis] - c.y[axis], c.depth * c.normal[axis], 1e-6);
+    }
+}
+
+TEST(PENETRATION, EMPTY) {
+    EXPECT_FALSE(paulista::collision::penetration(Shape{}, box(Point(), 1, 1, 1)));
+    EXPECT_FALSE(paulista::collision::penetration(box(Point(), 1, 1, 1), Shape{}));
+}
+
+TEST(PENETRATION, DISJOINT) {
+    EXPECT_FALSE(paulista::collision::penetration(box(Point(), 10, 10, 10), box(Point(11, 0, 0), 10, 10, 10)));
+}
+
+TEST(PENETRATION, BOXES) {
+    std::optional<paulista::collision::Contact> c = paulista::collision::penetration(
+              box(Point(0, 0, 0), 300, 200, 100)
+            , box(Point(250, 50, 20), 300, 200, 100)
+            );
+
+    ASSERT_TRUE(c);
+    EXPECT_NEAR(c->depth, 50.0, 1e-9);
+    EXPECT_NEAR(c->normal[0], 1.0, 1e-9);
+    EXPECT_NEAR(c->x[0], 300.0, 1e-6);
+    EXPECT_NEAR(c->y[0], 250.0, 1e-6);
+    consistent(*c);
+}
+
+TEST(PENETRATION, TOUCHING) {
+    std::optional<paulista::collision::Contact> c = paulista::collision::penetration(
+              box(Point(0, 0, 0), 10, 10, 10)
+            , box(Point(10, 0, 0), 10, 10, 10)
+            );
+
+    ASSERT_TRUE(c);
+    EXPECT_NEAR(c->depth, 0.0, 1e-9);
+}
+
+TEST(PENETRATION, FLAT) {
+    Shape xs = {{0, 0, 0}, {10, 0, 0}, {0, 10, 0}};
+    Shape ys = {{2, 2, 0}, {12, 2, 0}, {2, 12, 0}};
+
+    std::optional<paulista::collision::Contact> c = paulista::collision::penetration(xs, ys);
+    ASSERT_TRUE(c);
+    EXPECT_NEAR(c->depth, 0.0, 1e-9);
+    EXPECT_NEAR(std::abs(c->normal[2]), 1.0, 1e-9);
+}
+
+RC_GTEST_PROP(PENETRATION, AXES, (const Point& p, const Point& q)) {
+    std::array<double, 3> sizes = {300, 200, 100};
+    Shape xs = box(p, 300, 200, 100);
+    Shape ys = box(q, 300, 200, 100);
+
+    double depth = std::numeric_limits<double>::max();
+    for (std::size_t axis = 0; axis < 3; axis++) {
+        depth = std::min(depth, sizes[axis] - std::abs(coordinate(p, axis) - coordinate(q, axis)));
+    }
+    RC_PRE(depth >= 0.0);
+
+    std::optional<paulista::collision::Contact> c = paulista::collision::penetration(xs, ys);
+    ASSERT_TRUE(c);
+    EXPECT_NEAR(c->depth, depth, 1e-6);
+    consistent(*c);
+}
+
+RC_GTEST_PROP(PENETRATION, CLOUDS, (const std::vector<Point>& xs, const std::vector<Point>& ys)) {
+    RC_PRE(xs.size() >= 4 and ys.size() >= 4);
+
+    Shape us = xs;
+    Shape vs;
+    for (const Point& y : ys) { vs.push_back(Point(static_cast<std::int32_t>(y.x()) / 2, static_cast<std::int32_t>(y.y()) / 2, static_cast<std::int32_t>(y.z()) / 2)); }
+    RC_PRE(paulista::collision::detect(us, vs) == true);
+
+    std::optional<paulista::collision::Contact> c = paulista::collision::penetration(us, vs);
+    ASSERT_TRUE(c);
+    EXPECT_NEAR(c->depth, expected(us, vs), 1e-6 * std::max(1.0, c->depth));
+    consistent(*c);
+}
+
+int
+main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -2,8 +2,11 @@
 #include <paulista/paulista.hpp>
 #include <rapidcheck/gtest.h>
 
+using Meter         = paulista::dimension::Meter;
 using Millimeter    = paulista::dimension::Millimeter;
+using Micrometer    = paulista::dimension::Micrometer;
 using Point         = paulista::tridimensional::Point<Millimeter>;
+using Far           = paulista::tridimensional::Point<Micrometer>;
 
 namespace rc {
     template<>
@@ -17,6 +20,21 @@ namespace rc {
                     );
         }
     };
+
+    // Points over the whole 32-bit range, for the exact predicates.
+    template<>
+    struct Arbitrary<Far> {
+        static Gen<Far>
+        arbitrary() {
+            constexpr std::int32_t lowest = std::numeric_limits<std::int32_t>::min();
+            constexpr std::int32_t highest = std::numeric_limits<std::int32_t>::max();
+            return gen::construct<Far>(
+                      gen::inRange(lowest, highest)
+                    , gen::inRange(lowest, highest)
+                    , gen::inRange(lowest, highest)
+                    );
+        }
+    };
 }
 
 RC_GTEST_PROP(ADD, NEUTRAL, (const Point& xs)) {
@@ -135,6 +153,103 @@ TEST(CROSS, D1) {
     EXPECT_EQ(x.cross(z), -y);
 }
 
+TEST(DOT, WIDE) {
+    Far p(2000000, -3000000, 1000000);
+
+    EXPECT_EQ(paulista::tridimensional::point::dot(p, p), 14000000000000);
+    EXPECT_EQ(paulista::tridimensional::point::dot(p, -p), -14000000000000);
+}
+
+TEST(DOT, EXTREMES) {
+    using paulista::tridimensional::point::int128;
+    constexpr std::int32_t lowest = std::numeric_limits<std::int32_t>::min();
+    constexpr std::int32_t highest = std::numeric_limits<std::int32_t>::max();
+    Far top(highest, highest, highest);
+    Far bottom(lowest, lowest, lowest);
+
+    EXPECT_TRUE(paulista::tridimensional::point::dot(top, top) == 3 * int128{highest} * highest);
+    EXPECT_TRUE(paulista::tridimensional::point::dot(bottom, bottom) == 3 * int128{lowest} * lowest);
+    EXPECT_TRUE(paulista::tridimensional::point::dot(top, bottom) == 3 * int128{highest} * lowest);
+    EXPECT_TRUE(paulista::tridimensional::point::dot(top, top) > paulista::tridimensional::point::dot(Far(), top));
+}
+
+// Splits q in halves that stay in range, so that linearity holds only when
+// no partial sum wraps.
+RC_GTEST_PROP(DOT, LINEAR, (const Far& p, const Far& q)) {
+    Far h(static_cast<std::int32_t>(q.x()) / 2, static_cast<std::int32_t>(q.y()) / 2, static_cast<std::int32_t>(q.z()) / 2);
+    RC_ASSERT(paulista::tridimensional::point::dot(p, q)
+        ==  paulista::tridimensional::point::dot(p, h)
+        +   paulista::tridimensional::point::dot(p, q - h)
+        );
+    RC_ASSERT(paulista::tridimensional::point::dot(p, q) == paulista::tridimensional::point::dot(q, p));
+}
+
+RC_GTEST_PROP(DOT, NARROW, (const Point& xs, const Point& ys)) {
+    EXPECT_EQ(paulista::tridimensional::point::dot(xs, ys), static_cast<std::int32_t>(xs.dot(ys)));
+}
+
+TEST(CROSS, WIDE) {
+    constexpr std::int32_t lowest = std::numeric_limits<std::int32_t>::min();
+    constexpr std::int32_t highest = std::numeric_limits<std::int32_t>::max();
+
+    std::array<std::int64_t, 3> c = paulista::tridimensional::point::cross(Far(lowest, highest, 0), Far(highest, lowest, 0));
+    EXPECT_EQ(c[0], 0);
+    EXPECT_EQ(c[1], 0);
+    EXPECT_EQ(c[2], (std::int64_t{lowest} * lowest) - (std::int64_t{highest} * highest));
+
+    c = paulista::tridimensional::point::cross(Far(0, lowest, lowest), Far(0, highest, lowest));
+    EXPECT_EQ(c[0], (std::int64_t{lowest} * lowest) - (std::int64_t{lowest} * highest));
+}
+
+RC_GTEST_PROP(CROSS, NARROW, (const Point& xs, const Point& ys)) {
+    Point c = xs.cross(ys);
+    std::array<std::int64_t, 3> wide = paulista::tridimensional::point::cross(xs, ys);
+    EXPECT_EQ(wide[0], static_cast<std::int32_t>(c.x()));
+    EXPECT_EQ(wide[1], static_cast<std::int32_t>(c.y()));
+    EXPECT_EQ(wide[2], static_cast<std::int32_t>(c.z()));
+}
+
+TEST(ORIENT, D3) {
+    Point o(0, 0, 0);
+    Point x(1, 0, 0);
+    Point y(0, 1, 0);
+    Point z(0, 0, 1);
+
+    EXPECT_EQ(paulista::tridimensional::point::orient3d(o, x, y, z), 1);
+    EXPECT_EQ(paulista::tridimensional::point::orient3d(o, y, x, z), -1);
+    EXPECT_EQ(paulista::tridimensional::point::orient3d(o, x, y, x + y), 0);
+    EXPECT_EQ(paulista::tridimensional::point::volume(o, x, y, z * 5), 5);
+}
+
+// Coplanar points far from the origin must fall through the floating
+// point filter to the exact determinant, and a one unit nudge off their
+// plane must still be told apart.
+TEST(ORIENT, NEARLY_FLAT) {
+    using Far = paulista::tridimensional::Point<Micrometer>;
+    Far a(2147483000, -2147483000, 1000);
+    Far u(-1073741000, 1073741001, -3);
+    Far v(-1073741003, -7, 1073741000);
+
+    Far b = a + u;
+    Far c = a + v;
+    Far d = a + u + v;
+    EXPECT_EQ(paulista::tridimensional::point::volume(a, b, c, d), 0);
+    EXPECT_EQ(paulista::tridimensional::point::orient3d(a, b, c, d), 0);
+
+    for (const Far& e : {Far(1, 0, 0), Far(0, 1, 0), Far(0, 0, 1)}) {
+        auto exact = paulista::tridimensional::point::volume(a, b, c, d - e);
+        EXPECT_NE(exact, 0);
+        EXPECT_EQ(paulista::tridimensional::point::orient3d(a, b, c, d - e), (exact > 0) - (exact < 0));
+        EXPECT_EQ(paulista::tridimensional::point::orient3d(a, b, c, d + e), (exact < 0) - (exact > 0));
+    }
+}
+
+RC_GTEST_PROP(ORIENT, EXACT, (const Point& a, const Point& b, const Point& c, const Point& d)) {
+    auto exact = paulista::tridimensional::point::volume(a, b, c, d);
+    EXPECT_EQ(paulista::tridimensional::point::orient3d(a, b, c, d), (exact > 0) - (exact < 0));
+    EXPECT_EQ(paulista::tridimensional::point::orient3d(b, a, c, d), (exact < 0) - (exact > 0));
+}
+
 TEST(CENTROID, EMPTY) {
     EXPECT_FALSE(paulista::tridimensional::point::centroid<Millimeter>({}));
 }
@@ -165,6 +280,103 @@ RC_GTEST_PROP(CENTROID, PROGRESSION, (std::uint8_t size)) {
     EXPECT_EQ(mean, paulista::tridimensional::point::centroid(ps));
 }
 
+TEST(CENTROID, WIDE) {
+    using Far = paulista::tridimensional::Point<Micrometer>;
+    constexpr std::int32_t limit = std::numeric_limits<std::int32_t>::max();
+
+    std::vector<Far> ps(1000, Far(limit, -limit, limit - 1));
+    EXPECT_EQ(paulista::tridimensional::point::centroid(ps), Far(limit, -limit, limit - 1));
+}
+
+TEST(CONVERT, SHORT) {
+    std::vector<Point> ps(3);
+    std::vector<paulista::tridimensional::Point<Micrometer>> qs(2);
+
+    EXPECT_FALSE(paulista::tridimensional::point::convert<Micrometer>(std::span<const Point>(ps), std::span(qs)));
+}
+
+TEST(CONVERT, OVERFLOW) {
+    const std::int32_t limit = std::numeric_limits<std::int32_t>::max() / 1000;
+
+    std::vector<Point> ps(11, Point(limit, -limit, 0));
+    std::vector<paulista::tridimensional::Point<Micrometer>> qs(ps.size());
+    EXPECT_TRUE(paulista::tridimensional::point::convert<Micrometer>(std::span<const Point>(ps), std::span(qs)));
+    EXPECT_EQ(qs.back(), paulista::tridimensional::Point<Micrometer>(limit * 1000, -limit * 1000, 0));
+
+    ps[4] = Point(0, 0, -limit - 1);
+    EXPECT_FALSE(paulista::tridimensional::point::convert<Micrometer>(std::span<const Point>(ps), std::span(qs)));
+    ps[4] = Point();
+    ps[10] = Point(limit + 1, 0, 0);
+    EXPECT_FALSE(paulista::tridimensional::point::convert<Micrometer>(std::span<const Point>(ps), std::span(qs)));
+}
+
+RC_GTEST_PROP(CONVERT, POINTWISE, (const std::vector<Point>& ps)) {
+    std::vector<paulista::tridimensional::Point<Micrometer>> us(ps.size());
+    std::vector<paulista::tridimensional::Point<Meter>> ms(ps.size());
+    std::vector<Point> back(ps.size());
+
+    EXPECT_TRUE(paulista::tridimensional::point::convert<Micrometer>(std::span<const Point>(ps), std::span(us)));
+    EXPECT_TRUE(paulista::tridimensional::point::convert<Meter>(std::span<const Point>(ps), std::span(ms)));
+    EXPECT_TRUE(paulista::tridimensional::point::convert<Millimeter>(
+              std::span<const paulista::tridimensional::Point<Micrometer>>(us)
+            , std::span(back)
+            ));
+
+    for (std::size_t i = 0; i < ps.size(); i++) {
+        EXPECT_EQ(us[i], static_cast<paulista::tridimensional::Point<Micrometer>>(ps[i]));
+        EXPECT_EQ(ms[i], static_cast<paulista::tridimensional::Point<Meter>>(ps[i]));
+    }
+    EXPECT_EQ(back, ps);
+}
+
+TEST(CONVERT, KERNELS) {
+    namespace detail = paulista::tridimensional::point::detail;
+
+    std::vector<detail::Kernel> widening = {detail::scalar<Millimeter, Micrometer>};
+    std::vector<detail::Kernel> narrowing = {detail::scalar<Micrometer, Millimeter>};
+#if defined(__x86_64__) or defined(__i386__)
+    if (__builtin_cpu_supports("avx2")) {
+        widening.push_back(detail::avx2<Millimeter, Micrometer>);
+        narrowing.push_back(detail::avx2<Micrometer, Millimeter>);
+    }
+    if (__builtin_cpu_supports("sse4.2")) {
+        widening.push_back(detail::sse<Millimeter, Micrometer>);
+        narrowing.push_back(detail::sse<Micrometer, Millimeter>);
+    }
+#endif
+
+    const std::int32_t limit = std::numeric_limits<std::int32_t>::max() / 1000;
+    std::vector<std::int32_t> in;
+    for (std::int32_t i = 0; i < 1001; i++) {
+        in.push_back(((i * 7919) % 2000001) - 1000000);
+    }
+    in[17] = std::numeric_limits<std::int32_t>::max();
+    in[18] = std::numeric_limits<std::int32_t>::min();
+    in[19] = -1999;
+
+    std::vector<std::int32_t> expected(in.size());
+    std::vector<std::int32_t> out(in.size());
+
+    detail::scalar<Micrometer, Millimeter>(in.data(), expected.data(), in.size());
+    for (detail::Kernel k : narrowing) {
+        EXPECT_TRUE(k(in.data(), out.data(), in.size()));
+        EXPECT_EQ(out, expected);
+    }
+
+    in[17] = limit + 1;
+    in[18] = -limit;
+    detail::scalar<Millimeter, Micrometer>(in.data(), expected.data(), in.size());
+    for (detail::Kernel k : widening) {
+        EXPECT_FALSE(k(in.data(), out.data(), in.size()));
+        EXPECT_EQ(out, expected);
+    }
+    for (std::size_t i = 0; i < in.size(); i++) { in[i] %= limit; }
+    for (detail::Kernel k : widening) {
+        EXPECT_TRUE(k(in.data(), out.data(), in.size()));
+        EXPECT_TRUE(k(in.data(), out.data(), 7));
+    }
+}
+
 int
 main(int argc, char** argv) {
     testing::InitGoogleTest(&argc, argv);
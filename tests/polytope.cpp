@@ -0,0 +1,178 @@
+#include <gtest/gtest.h>
+#include <paulista/paulista.hpp>
+#include <rapidcheck/gtest.h>
+
+using Millimeter    = paulista::dimension::Millimeter;
+using Point         = paulista::tridimensional::Point<Millimeter>;
+using Polytope      = paulista::collision::Polytope<Millimeter>;
+using Shape         = paulista::collision::Shape<Millimeter>;
+using Face          = paulista::collision::Face;
+
+namespace rc {
+    template<>
+    struct Arbitrary<Point> {
+        static Gen<Point>
+        arbitrary() {
+            return gen::construct<Point>(
+                      gen::inRange(-1000, 1000)
+                    , gen::inRange(-1000, 1000)
+                    , gen::inRange(-1000, 1000)
+                    );
+        }
+    };
+}
+
+std::int64_t
+dot(const Point& p, const Point& v) {
+    return  (std::int64_t{static_cast<std::int32_t>(p.x())} * static_cast<std::int32_t>(v.x()))
+        +   (std::int64_t{static_cast<std::int32_t>(p.y())} * static_cast<std::int32_t>(v.y()))
+        +   (std::int64_t{static_cast<std::int32_t>(p.z())} * static_cast<std::int32_t>(v.z()))
+        ;
+}
+
+Polytope
+box(const Point& p, std::int32_t side) {
+    Shape vertices;
+    for (std::int32_t i = 0; i < 8; i++) {
+        vertices.push_back(p + Point((i & 1) * side, ((i >> 1) & 1) * side, ((i >> 2) & 1) * side));
+    }
+    std::vector<Face> faces = {
+          {0, 1, 3}, {0, 3, 2}
+        , {4, 5, 7}, {4, 7, 6}
+        , {0, 1, 5}, {0, 5, 4}
+        , {2, 3, 7}, {2, 7, 6}
+        , {0, 2, 6}, {0, 6, 4}
+        , {1, 3, 7}, {1, 7, 5}
+    };
+    return Polytope(vertices, faces);
+}
+
+// Cyclic polytope on the moment curve, whose facets follow Gale's evenness
+// condition.
+Polytope
+cyclic(std::int32_t n) {
+    Shape vertices;
+    for (std::int32_t i = 0; i < n; i++) {
+        std::int32_t t = i - (n / 2);
+        vertices.emplace_back(t, t * t, t * t * t);
+    }
+    std::vector<Face> faces;
+    for (std::size_t i = 1; i + 1 < static_cast<std::size_t>(n); i++) {
+        faces.push_back({0, i, i + 1});
+    }
+    for (std::size_t i = 0; i + 2 < static_cast<std::size_t>(n) - 1; i++) {
+        faces.push_back({i, i + 1, static_cast<std::size_t>(n) - 1});
+    }
+    return Polytope(vertices, faces);
+}
+
+TEST(POLYTOPE, EMPTY) {
+    Polytope ps;
+    EXPECT_FALSE(paulista::collision::support(ps, Point(1, 0, 0)));
+}
+
+TEST(POLYTOPE, ADJACENCY) {
+    Polytope ps = box(Point(0, 0, 0), 2);
+    for (std::size_t i = 0; i < ps.size(); i++) {
+        EXPECT_GE(ps.degree(i), 3);
+        EXPECT_LE(ps.degree(i), 6);
+    }
+}
+
+TEST(POLYTOPE, PLATEAU) {
+    Shape vertices = {
+          {0, 0, 0}
+        , {4, 0, 0}
+        , {0, 4, 0}
+        , {1, 1, 0}
+        , {0, 0, 4}
+    };
+    std::vector<Face> faces = {
+          {3, 0, 1}, {3, 1, 2}, {3, 2, 0}
+        , {0, 1, 4}, {1, 2, 4}, {2, 0, 4}
+    };
+    Polytope ps(vertices, faces);
+
+    std::size_t i = ps.climb(Point(0, 0, 1), 3);
+    EXPECT_EQ(ps[i], Point(0, 0, 4));
+}
+
+TEST(POLYTOPE, LARGE_PLATEAU) {
+    constexpr std::int32_t n = 40;
+
+    // Square pyramid with its base tessellated into an n by n grid, so a
+    // climb along the base normal floods every grid vertex.
+    Shape vertices;
+    for (std::int32_t i = 0; i <= n; i++) {
+        for (std::int32_t j = 0; j <= n; j++) { vertices.emplace_back(i, j, 0); }
+    }
+    std::size_t apex = vertices.size();
+    vertices.emplace_back(n / 2, n / 2, -n);
+
+    auto at = [](std::int32_t i, std::int32_t j) { return static_cast<std::size_t>((i * (n + 1)) + j); };
+    std::vector<Face> faces;
+    for (std::int32_t i = 0; i < n; i++) {
+        for (std::int32_t j = 0; j < n; j++) {
+            faces.push_back({at(i, j), at(i + 1, j), at(i + 1, j + 1)});
+            faces.push_back({at(i, j), at(i + 1, j + 1), at(i, j + 1)});
+        }
+        faces.push_back({at(i, 0), at(i + 1, 0), apex});
+        faces.push_back({at(i, n), at(i + 1, n), apex});
+        faces.push_back({at(0, i), at(0, i + 1), apex});
+        faces.push_back({at(n, i), at(n, i + 1), apex});
+    }
+    Polytope ps(vertices, faces);
+
+    EXPECT_EQ(ps[ps.climb(Point(0, 0, 1), apex)].z(), 0);
+    EXPECT_EQ(ps[ps.climb(Point(0, 0, 1), at(n / 2, n / 2))].z(), 0);
+    EXPECT_EQ(ps[ps.climb(Point(0, 0, -1), at(0, 0))], vertices[apex]);
+}
+
+RC_GTEST_PROP(POLYTOPE, BOX, (const Point& p, const Point& v)) {
+    Polytope ps = box(p, 10);
+
+    std::optional<Point> expected = paulista::collision::support(ps.vertices(), v);
+    std::optional<Point> climbed  = paulista::collision::support(ps, v);
+    ASSERT_TRUE(climbed);
+    EXPECT_EQ(dot(*climbed, v), dot(*expected, v));
+}
+
+RC_GTEST_PROP(POLYTOPE, CYCLIC, (const Point& v, std::uint8_t start)) {
+    Polytope ps = cyclic(64);
+
+    std::optional<Point> expected = paulista::collision::support(ps.vertices(), v);
+    std::size_t i = ps.climb(v, start % ps.size());
+    EXPECT_EQ(dot(ps[i], v), dot(*expected, v));
+}
+
+TEST(POLYTOPE, COHERENT) {
+    Polytope ps = cyclic(64);
+    for (std::int32_t i = -500; i < 500; i++) {
+        Point v(i, 1000 - std::abs(i), 7);
+
+        std::optional<Point> expected = paulista::collision::support(ps.vertices(), v);
+        std::optional<Point> climbed  = paulista::collision::support(ps, v);
+        ASSERT_TRUE(climbed);
+        EXPECT_EQ(dot(*climbed, v), dot(*expected, v));
+    }
+}
+
+RC_GTEST_PROP(POLYTOPE, DETECT, (const Point& p, const Point& q)) {
+    Polytope xs = box(p, 300);
+    Polytope ys = box(q, 300);
+
+    EXPECT_EQ(
+              paulista::collision::detect(xs, ys)
+            , paulista::collision::detect(xs.vertices(), ys.vertices())
+            );
+    EXPECT_EQ(
+              paulista::collision::detect(xs, ys.vertices())
+            , paulista::collision::detect(xs.vertices(), ys.vertices())
+            );
+}
+
+int
+main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
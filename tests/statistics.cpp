@@ -0,0 +1,142 @@
+#define PAULISTA_STATISTICS
+
+#include <gtest/gtest.h>
+#include <paulista/paulista.hpp>
+#include <rapidcheck/gtest.h>
+
+#include <thread>
+#include <type_traits>
+
+#include "fixtures.hpp"
+
+using Millimeter    = paulista::dimension::Millimeter;
+using Point         = paulista::tridimensional::Point<Millimeter>;
+using Shape         = paulista::collision::Shape<Millimeter>;
+using Statistics    = paulista::collision::Statistics;
+
+namespace statistics = paulista::collision::statistics;
+
+namespace rc {
+    template<>
+    struct Arbitrary<Point> {
+        static Gen<Point>
+        arbitrary() {
+            return gen::construct<Point>(
+                      gen::inRange(-1000, 1000)
+                    , gen::inRange(-1000, 1000)
+                    , gen::inRange(-1000, 1000)
+                    );
+        }
+    };
+}
+
+std::uint64_t
+transitions(const Statistics& s) {
+    return s.transitions[0] + s.transitions[1] + s.transitions[2] + s.transitions[3];
+}
+
+TEST(STATISTICS, DISABLED) {
+    static_assert(statistics::enabled);
+    static_assert(std::is_empty_v<statistics::detail::Probe<false>>);
+}
+
+TEST(STATISTICS, SEPARATED) {
+    statistics::reset();
+    ASSERT_EQ(paulista::collision::detect(box(Point(0, 0, 0), 10, 10, 10), box(Point(100, 0, 0), 10, 10, 10)), false);
+
+    Statistics s = statistics::collect();
+    EXPECT_EQ(s.queries, 1);
+    EXPECT_EQ(s.early_outs, 1);
+    EXPECT_EQ(s.rate(), 1.0);
+    EXPECT_GE(s.iterations, 1);
+    EXPECT_EQ(s.supports, 2 * s.iterations);
+    EXPECT_EQ(s.longest, s.iterations);
+    EXPECT_EQ(transitions(s), s.iterations - 1);
+
+    Statistics l = statistics::last();
+    EXPECT_EQ(l.queries, 1);
+    EXPECT_EQ(l.iterations, s.iterations);
+}
+
+TEST(STATISTICS, INTERSECTING) {
+    statistics::reset();
+    ASSERT_EQ(paulista::collision::detect(box(Point(0, 0, 0), 10, 10, 10), box(Point(5, 5, 5), 10, 10, 10)), true);
+
+    Statistics s = statistics::collect();
+    EXPECT_EQ(s.queries, 1);
+    EXPECT_EQ(s.early_outs, 0);
+    EXPECT_EQ(s.supports, 2 * s.iterations);
+    EXPECT_EQ(transitions(s), s.iterations);
+    EXPECT_EQ(s.transitions[0], 0);
+}
+
+RC_GTEST_PROP(STATISTICS, SUMS, (const Point& p, const Point& q)) {
+    Shape xs = box(p, 100, 200, 300);
+    Shape ys = box(q, 300, 200, 100);
+
+    statistics::reset();
+    Statistics expected;
+    for (std::size_t i = 0; i < 3; i++) {
+        paulista::collision::detect(xs, ys);
+        expected += statistics::last();
+    }
+    Statistics actual = statistics::collect();
+    EXPECT_EQ(actual.queries, 3);
+    EXPECT_EQ(actual.supports, expected.supports);
+    EXPECT_EQ(actual.iterations, expected.iterations);
+    EXPECT_EQ(actual.early_outs, expected.early_outs);
+    EXPECT_EQ(actual.longest, expected.longest);
+    EXPECT_EQ(actual.transitions, expected.transitions);
+    EXPECT_LE(actual.longest, paulista::collision::detail::iterations);
+}
+
+// Counters of pool workers are merged while they run, and those of
+// exited threads are kept.
+TEST(STATISTICS, THREADS) {
+    using Candidate = std::pair<const Shape*, const Shape*>;
+
+    std::vector<Shape> shapes;
+    for (std::int32_t i = 0; i < 100; i++) {
+        shapes.push_back(box(Point((i * 37) % 1000, (i * 91) % 1000, (i * 53) % 1000), 300, 200, 100));
+    }
+
+    std::vector<Candidate> pairs;
+    for (std::size_t i = 0; i < shapes.size(); i++) {
+        for (std::size_t j = i + 1; j < shapes.size(); j++) {
+            pairs.push_back({&shapes[i], &shapes[j]});
+        }
+    }
+
+    statistics::reset();
+    std::vector<std::optional<bool>> results(pairs.size());
+    {
+        paulista::parallel::Pool pool(4);
+        ASSERT_TRUE(paulista::collision::detect_batch(std::span<const Candidate>(pairs), std::span(results), pool));
+        EXPECT_EQ(statistics::collect().queries, pairs.size());
+    }
+    std::jthread([&shapes]() { paulista::collision::detect(shapes[0], shapes[1]); }).join();
+
+    std::uint64_t disjoint = 0;
+    for (const std::optional<bool>& r : results) { disjoint += (r == false); }
+
+    Statistics s = statistics::collect();
+    EXPECT_EQ(s.queries, pairs.size() + 1);
+    EXPECT_GE(s.early_outs, disjoint);
+    EXPECT_EQ(s.supports, 2 * s.iterations);
+}
+
+TEST(STATISTICS, DISTANCE) {
+    statistics::reset();
+    ASSERT_TRUE(paulista::collision::distance(box(Point(0, 0, 0), 10, 10, 10), box(Point(100, 0, 0), 10, 10, 10)));
+
+    Statistics s = statistics::collect();
+    EXPECT_EQ(s.queries, 1);
+    EXPECT_EQ(s.early_outs, 0);
+    EXPECT_GE(s.iterations, 1);
+}
+
+int
+main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+#include <paulista/paulista.hpp>
+#include <rapidcheck/gtest.h>
+
+#include <algorithm>
+
+#include "fixtures.hpp"
+
+using Millimeter    = paulista::dimension::Millimeter;
+using Point         = paulista::tridimensional::Point<Millimeter>;
+using Box           = paulista::tridimensional::Box<Millimeter>;
+using Sweep         = paulista::collision::Sweep<Millimeter>;
+using Pair          = paulista::collision::Pair;
+
+namespace rc {
+    template<>
+    struct Arbitrary<Point> {
+        static Gen<Point>
+        arbitrary() {
+            return gen::construct<Point>(
+                      gen::inRange(-1000, 1000)
+                    , gen::inRange(-1000, 1000)
+                    , gen::inRange(-1000, 1000)
+                    );
+        }
+    };
+}
+
+std::vector<Box>
+boxes(const std::vector<Point>& ps) {
+    std::vector<Box> bs;
+    for (const Point& p : ps) { bs.emplace_back(p, p + Point(300, 200, 100)); }
+    return bs;
+}
+
+TEST(SWEEP, EMPTY) {
+    Sweep sweep(std::vector<Box>{});
+    std::vector<Pair> added;
+    std::vector<Pair> removed;
+    EXPECT_TRUE(sweep.update({}, added, removed));
+
+    EXPECT_TRUE(sweep.pairs().empty());
+    EXPECT_TRUE(added.empty());
+    EXPECT_TRUE(removed.empty());
+}
+
+TEST(SWEEP, TOUCHING) {
+    std::vector<Box> bs = {
+          Box(Point(0, 0, 0), Point(1, 1, 1))
+        , Box(Point(2, 0, 0), Point(3, 1, 1))
+    };
+    Sweep sweep(bs);
+    EXPECT_TRUE(sweep.pairs().empty());
+
+    std::vector<Pair> added;
+    std::vector<Pair> removed;
+    bs[1] = Box(Point(1, 0, 0), Point(2, 1, 1));
+    ASSERT_TRUE(sweep.update(bs, added, removed));
+    EXPECT_EQ(added, (std::vector<Pair>{{0, 1}}));
+    EXPECT_TRUE(removed.empty());
+
+    added.clear();
+    bs[1] = Box(Point(2, 1, 0), Point(3, 2, 1));
+    ASSERT_TRUE(sweep.update(bs, added, removed));
+    EXPECT_TRUE(added.empty());
+    EXPECT_EQ(removed, (std::vector<Pair>{{0, 1}}));
+}
+
+TEST(SWEEP, UPDATE_SIZE) {
+    std::vector<Box> bs = {
+          Box(Point(0, 0, 0), Point(2, 2, 2))
+        , Box(Point(1, 1, 1), Point(3, 3, 3))
+        , Box(Point(9, 9, 9), Point(10, 10, 10))
+    };
+    Sweep sweep(bs);
+    std::vector<Pair> before = sweep.pairs();
+
+    std::vector<Pair> added;
+    std::vector<Pair> removed;
+    std::vector<Box> fewer(bs.begin(), bs.begin() + 1);
+    EXPECT_FALSE(sweep.update(fewer, added, removed));
+    std::vector<Box> more = bs;
+    more.push_back(Box(Point(0, 0, 0), Point(10, 10, 10)));
+    EXPECT_FALSE(sweep.update(more, added, removed));
+
+    EXPECT_EQ(sweep.size(), bs.size());
+    EXPECT_EQ(sweep.pairs(), before);
+    EXPECT_TRUE(added.empty());
+    EXPECT_TRUE(removed.empty());
+
+    EXPECT_TRUE(sweep.update(bs, added, removed));
+}
+
+RC_GTEST_PROP(SWEEP, PAIRS, (const std::vector<Point>& ps)) {
+    std::vector<Box> bs = boxes(ps);
+    EXPECT_EQ(sorted(Sweep(bs).pairs()), brute(bs));
+}
+
+RC_GTEST_PROP(SWEEP, EVENTS, (const std::vector<Point>& ps, const std::vector<Point>& motion)) {
+    std::vector<Box> bs = boxes(ps);
+    Sweep sweep(bs);
+
+    std::vector<Pair> current = brute(bs);
+    for (std::size_t frame = 0; frame < 4; frame++) {
+        for (std::size_t i = 0; i < bs.size() and not motion.empty(); i++) {
+            Point m  = motion[(i + frame) % motion.size()];
+            Point dp = Point(
+                      static_cast<std::int32_t>(m.x()) / 20
+                    , static_cast<std::int32_t>(m.y()) / 20
+                    , static_cast<std::int32_t>(m.z()) / 20
+                    );
+            bs[i] = Box(bs[i].lower() + dp, bs[i].upper() + dp);
+        }
+
+        std::vector<Pair> added;
+        std::vector<Pair> removed;
+        RC_ASSERT(sweep.update(bs, added, removed));
+
+        std::vector<Pair> gone = sorted(removed);
+        std::vector<Pair> next;
+        std::set_difference(
+                  current.begin(), current.end()
+                , gone.begin(), gone.end()
+                , std::back_inserter(next)
+                );
+        next.insert(next.end(), added.begin(), added.end());
+        current = sorted(next);
+
+        EXPECT_EQ(current, brute(bs));
+        EXPECT_EQ(sorted(sweep.pairs()), current);
+    }
+}
+
+int
+main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
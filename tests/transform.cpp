@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+#include <paulista/paulista.hpp>
+#include <rapidcheck/gtest.h>
+
+#include <algorithm>
+#include <cstdlib>
+
+#include "fixtures.hpp"
+
+using Millimeter    = paulista::dimension::Millimeter;
+using Point         = paulista::tridimensional::Point<Millimeter>;
+using Rotation      = paulista::tridimensional::Rotation;
+using Shape         = paulista::collision::Shape<Millimeter>;
+using Transformed   = paulista::collision::Transformed<Shape>;
+
+namespace rc {
+    template<>
+    struct Arbitrary<Point> {
+        static Gen<Point>
+        arbitrary() {
+            return gen::construct<Point>(
+                      gen::inRange(-1000, 1000)
+                    , gen::inRange(-1000, 1000)
+                    , gen::inRange(-1000, 1000)
+                    );
+        }
+    };
+}
+
+// Rotation permuting the axes and flipping their signs, which is exact
+// in fixed point.
+Rotation
+axes(unsigned permutation, unsigned signs) {
+    std::array<std::size_t, 3> order = {0, 1, 2};
+    for (unsigned i = 0; i < permutation % 6; i++) { std::next_permutation(order.begin(), order.end()); }
+
+    Rotation::Matrix m = {};
+    for (std::size_t r = 0; r < 3; r++) {
+        m[r][order[r]] = ((signs >> r) & 1) ? -Rotation::one : Rotation::one;
+    }
+    return Rotation(m);
+}
+
+std::int64_t
+dot(const Point& p, const Point& v) {
+    return paulista::tridimensional::point::dot(p, v);
+}
+
+Shape
+materialize(const Shape& ps, const Rotation& r, const Point& t) {
+    Shape qs;
+    for (const Point& p : ps) { qs.push_back(r(p) + t); }
+    return qs;
+}
+
+TEST(ROTATION, IDENTITY) {
+    EXPECT_EQ(Rotation(), Rotation(1.0, 0.0, 0.0, 0.0));
+    EXPECT_EQ(Rotation(), Rotation(0.0, 0.0, 0.0, 0.0));
+    EXPECT_EQ(Rotation()(Point(1, -2, 3)), Point(1, -2, 3));
+    EXPECT_EQ(Rotation().inverse(Point(1, -2, 3)), Point(1, -2, 3) * (1 << 28));
+}
+
+TEST(ROTATION, QUARTER) {
+    double h = std::sqrt(0.5);
+    Rotation r(h, 0.0, 0.0, h);
+
+    Rotation::Matrix expected = {{
+          {0, -Rotation::one, 0}
+        , {Rotation::one, 0, 0}
+        , {0, 0, Rotation::one}
+    }};
+    EXPECT_EQ(r.matrix(), expected);
+    EXPECT_EQ(r(Point(1, 2, 3)), Point(-2, 1, 3));
+    EXPECT_EQ(r.inverse(Point(0, 1, 0)), Point(1 << 30, 0, 0));
+}
+
+RC_GTEST_PROP(TRANSFORMED, TRANSLATED, (const std::vector<Point>& ps, const Point& t, const Point& v)) {
+    RC_PRE(not ps.empty());
+
+    Transformed ts(ps, t);
+    Shape qs = materialize(ps, Rotation(), t);
+    RC_ASSERT(ts.size() == qs.size());
+    RC_ASSERT(ts[0] == qs[0]);
+    RC_ASSERT(dot(*paulista::collision::support(ts, v), v) == dot(*paulista::collision::support(qs, v), v));
+}
+
+RC_GTEST_PROP(TRANSFORMED, AXES, (const Point& p, const Point& q, const Point& t, unsigned permutation, unsigned signs)) {
+    Rotation r = axes(permutation, signs);
+    Shape xs = box(p, 100, 200, 300);
+    Shape ys = box(q, 300, 200, 100);
+
+    Transformed ts(xs, r, t);
+    Shape qs = materialize(xs, r, t);
+    RC_ASSERT(paulista::collision::detect(ts, ys) == paulista::collision::detect(qs, ys));
+    RC_ASSERT(paulista::collision::detect(ys, ts) == paulista::collision::detect(ys, qs));
+    RC_ASSERT(dot(*paulista::collision::support(ts, q), q) == dot(*paulista::collision::support(qs, q), q));
+}
+
+// Any other rotation rounds the rotated points, so the support may fall
+// short of the farthest one by that rounding.
+RC_GTEST_PROP(TRANSFORMED, ROTATED, (const std::vector<Point>& ps, const Point& t, const Point& v, const Point& axis, int angle)) {
+    RC_PRE(not ps.empty());
+
+    double half = (angle % 360) * (3.14159265358979323846 / 360.0);
+    double s = std::sin(half) / std::max(1.0, std::sqrt(static_cast<double>(dot(axis, axis))));
+    Rotation r(
+              std::cos(half)
+            , s * static_cast<std::int32_t>(axis.x())
+            , s * static_cast<std::int32_t>(axis.y())
+            , s * static_cast<std::int32_t>(axis.z())
+            );
+
+    Transformed ts(ps, r, t);
+    Shape qs = materialize(ps, r, t);
+
+    std::optional<Point> actual = paulista::collision::support(ts, v);
+    RC_ASSERT(actual);
+    RC_ASSERT(std::find(qs.begin(), qs.end(), *actual) != qs.end());
+
+    std::int64_t slack = std::abs(static_cast<std::int32_t>(v.x())) + std::abs(static_cast<std::int32_t>(v.y())) + std::abs(static_cast<std::int32_t>(v.z()));
+    RC_ASSERT(dot(*paulista::collision::support(qs, v), v) - dot(*actual, v) <= slack);
+}
+
+TEST(TRANSFORMED, POLYTOPE) {
+    paulista::collision::Hull<Millimeter> h = paulista::collision::hull(box(Point(0, 0, 0), 10, 20, 30));
+    paulista::collision::Polytope<Millimeter> polytope(h.vertices, h.faces);
+
+    double c = std::sqrt(0.5);
+    paulista::collision::Transformed<paulista::collision::Polytope<Millimeter>> ts(polytope, Rotation(c, c, 0.0, 0.0), Point(100, 0, 0));
+
+    EXPECT_EQ(paulista::collision::support(ts, Point(0, 0, 1))->z(), 20);
+    EXPECT_EQ(paulista::collision::support(ts, Point(0, -1, 0))->y(), -30);
+    EXPECT_EQ(paulista::collision::detect(ts, box(Point(105, -35, 15), 10, 10, 10)), true);
+    EXPECT_EQ(paulista::collision::detect(ts, box(Point(105, 5, 15), 10, 10, 10)), false);
+}
+
+int
+main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}